@@ -1,304 +1,1702 @@
-#include "Algorithms.hpp"
-#include <vector>
-#include <climits>
-
-namespace ariel {
-    std::string Algorithms::isBipartite(const Graph &g) {
-        int numVertices = g.getNumVertices();
-        std::vector<int> color(numVertices, -1); // -1 indicates uncolored
-
-        // Use BFS to attempt to color the graph
-        for (int start = 0; start < numVertices; ++start) {
-            if (color[start] == -1) { // If the vertex is uncolored
-                std::queue<int> q;
-                q.push(start);
-                color[start] = 0; // Start coloring with 0
-
-                while (!q.empty()) {
-                    int u = q.front();
-                    q.pop();
-
-                    // Get all adjacent vertices
-                    const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
-                    for (int v = 0; v < numVertices; ++v) {
-                        if (adjacencyMatrix[u][v] != 0) { // There's an edge
-                            if (color[v] == -1) { // If uncolored, color with opposite color
-                                color[v] = 1 - color[u];
-                                q.push(v);
-                            } else if (color[v] == color[u]) { // If colored the same as adjacent
-                                return "The graph is not bipartite.";
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        // If bipartite, organize vertices into sets A and B
-        std::vector<int> setA;
-        std::vector<int> setB;
-        for (int i = 0; i < numVertices; ++i) {
-            if (color[i] == 0) {
-                setA.push_back(i);
-            } else if (color[i] == 1) {
-                setB.push_back(i);
-            }
-        }
-
-        // Format the output to show two sets
-        std::stringstream ss;
-        ss << "The graph is bipartite: A={";
-        for (size_t i = 0; i < setA.size(); ++i) {
-            ss << setA[i];
-            if (i < setA.size() - 1) ss << ", ";
-        }
-        ss << "}, B={";
-        for (size_t i = 0; i < setB.size(); ++i) {
-            ss << setB[i];
-            if (i < setB.size() - 1) ss << ", ";
-        }
-        ss << "}.";
-        return ss.str();
-    }
-    
-    
-    
-    
-    
-    
-    bool Algorithms::isConnected(const Graph& g) {
-    int numVertices = g.getNumVertices();
-    const std::vector<std::vector<int>>& adjMatrix = g.getAdjacencyMatrix();
-
-    std::vector<bool> visited(numVertices, false);
-    
-    // Find a vertex with non-zero out-degree to start DFS
-    for (int start = 0; start < numVertices; ++start) {
-        std::fill(visited.begin(), visited.end(), false);
-        int outDegree = 0;
-        for (int i = 0; i < numVertices; ++i) {
-            if (adjMatrix[start][i] != 0) {
-                outDegree++;
-            }
-        }
-        if (outDegree == 0) continue;  // Skip if no outgoing edges
-        
-        // Simple DFS
-        std::stack<int> stack;
-        stack.push(start);
-        visited[start] = true;
-        int count = 1;
-
-        while (!stack.empty()) {
-            int node = stack.top();
-            stack.pop();
-
-            for (int adj = 0; adj < numVertices; ++adj) {
-                if (adjMatrix[node][adj] != 0 && !visited[adj]) {
-                    visited[adj] = true;
-                    stack.push(adj);
-                    count++;
-                }
-            }
-        }
-        
-        if (count == numVertices) return true;  // Found a node from which all nodes are reachable
-    }
-
-    return false;  // No such starting node found
-}
-
-     
-std::string Algorithms::shortestPath(const Graph& g, int start, int end) {
-    int numVertices = g.getNumVertices();
-    const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
-
-    // Initialize distances and parent arrays
-    std::vector<int> distances(numVertices, INT_MAX);
-    std::vector<int> parents(numVertices, -1);
-    distances[start] = 0;
-
-    // Relax edges repeatedly
-    for (int i = 1; i < numVertices; ++i) {
-        for (int u = 0; u < numVertices; ++u) {
-            for (int v = 0; v < numVertices; ++v) {
-                if (adjacencyMatrix[u][v] > 0 && distances[u] != INT_MAX && 
-                    distances[u] + adjacencyMatrix[u][v] < distances[v]) {
-                    distances[v] = distances[u] + adjacencyMatrix[u][v];
-                    parents[v] = u;
-                }
-            }
-        }
-    }
-
-    // Check for negative-weight cycles
-    for (int u = 0; u < numVertices; ++u) {
-        for (int v = 0; v < numVertices; ++v) {
-            if (adjacencyMatrix[u][v] > 0 && distances[u] != INT_MAX && 
-                distances[u] + adjacencyMatrix[u][v] < distances[v]) {
-                return "Graph contains a negative weight cycle";
-            }
-        }
-    }
-
-    // If no path exists
-    if (distances[end] == INT_MAX) {
-        return "-1";
-    }
-
-    // Reconstruct the shortest path
-    std::vector<int> path;
-    int at = end;
- while (at != -1) {
-    path.push_back(at);
-    if (at == start) break;  // Stop if we've reached the start
-    at = parents[at];
-}
-
-    
-    if (path.back() != start) { // Check if the path is valid
-        return "No path exists";
-    }
-    
-    std::reverse(path.begin(), path.end());
-
-    // Convert path to string representation
-    std::stringstream ss;
-    for (size_t i = 0; i < path.size(); ++i) {
-        ss << path[i];
-        if (i < path.size() - 1) {
-            ss << "->";
-        }
-    }
-
-    return ss.str();
-}
-
-bool Algorithms::hasCycleHelper(const Graph& g, int v, std::vector<bool>& visited, int parent, std::vector<int>& cycle) {
-    visited[v] = true;
-    cycle.push_back(v);  // Add current vertex to the cycle
-
-    const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
-    int numVertices = adjacencyMatrix.size();
-
-    for (int u = 0; u < numVertices; ++u) {
-        if (adjacencyMatrix[v][u] != 0) { // There is an edge from v to u
-            if (!visited[u]) { // If u has not been visited, recurse
-                if (hasCycleHelper(g, u, visited, v, cycle)) {
-                    
-                    return true;
-                }
-            } else if (u != parent) { // u is visited and not the parent, cycle detected
-                // Avoid adding 'u' again, just return true to indicate cycle is complete
-                return true;
-            }
-        }
-    }
-
-    cycle.pop_back(); // No cycle found with v as a start point, backtrack
-    return false;
-}
-
-std::string Algorithms::isContainsCycle(const Graph &g) {
-    int numVertices = g.getNumVertices();
-    std::vector<bool> visited(numVertices, false);
-    std::vector<int> cycle;
-
-    for (int v = 0; v < numVertices; ++v) {
-        if (!visited[v]) {
-            if (hasCycleHelper(g, v, visited, -1, cycle)) {
-                std::cerr << "Cycle detected: ";
-    for (int node : cycle) std::cerr << node << " ";
-    std::cerr << std::endl;
-                // Cycle found, format it into a string
-                std::stringstream ss;
-                for (size_t i = 0; i < cycle.size(); ++i) {
-                    ss << cycle[i];
-                    if (i < cycle.size() - 1) {
-                        ss << "->";
-                    }
-                }
-                ss << "->" << cycle[0]; // Complete the cycle by connecting back to the start
-                return ss.str();
-            }
-        }
-    }
-
-    return "0"; // If no cycle is found
-}
-
-
-  static bool bellmanFord(const Graph& g, int src, std::vector<int>& parent, std::vector<int>& dist) {
-        int numVertices = g.getNumVertices();
-        dist.assign(numVertices, INT_MAX);
-        dist[src] = 0;
-        parent.assign(numVertices, -1);
-
-        const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
-
-        // Relax all edges |V| - 1 times
-        for (int i = 0; i < numVertices - 1; ++i) {
-            for (int u = 0; u < numVertices; ++u) {
-                for (int v = 0; v < numVertices; ++v) {
-                    if (adjacencyMatrix[u][v] != 0 && dist[u] != INT_MAX &&
-                        dist[u] + adjacencyMatrix[u][v] < dist[v]) {
-                        dist[v] = dist[u] + adjacencyMatrix[u][v];
-                        parent[v] = u;
-                    }
-                }
-            }
-        }
-
-        // Check for negative-weight cycles
-        for (int u = 0; u < numVertices; ++u) {
-            for (int v = 0; v < numVertices; ++v) {
-                if (adjacencyMatrix[u][v] != 0 && dist[u] != INT_MAX &&
-                    dist[u] + adjacencyMatrix[u][v] < dist[v]) {
-                    return true; // Negative cycle found
-                }
-            }
-        }
-
-        return false;
-    }
-
-    std::string Algorithms::negativeCycle(const Graph &g) {
-        int numVertices = g.getNumVertices();
-        std::vector<int> parent(numVertices);
-        std::vector<int> dist(numVertices);
-
-        for (int src = 0; src < numVertices; ++src) {
-            if (bellmanFord(g, src, parent, dist)) {
-                // Find a vertex part of the cycle
-                int v = src;
-                for (int i = 0; i < numVertices; ++i) { // Move far enough in the cycle
-                    v = parent[v];
-                }
-
-                // Locate the start of the cycle
-                std::vector<int> cycle;
-                int start = v;
-                do {
-                    cycle.push_back(v);
-                    v = parent[v];
-                } while (v != start);
-
-                cycle.push_back(start); // Close the cycle
-                std::reverse(cycle.begin(), cycle.end());
-                
-                // Convert cycle to string
-                std::stringstream ss;
-                for (size_t i = 0; i < cycle.size(); ++i) {
-                    ss << cycle[i];
-                    if (i < cycle.size() - 1) {
-                        ss << "->";
-                    }
-                }
-                return ss.str();
-            }
-        }
-
-        return "0"; // No negative cycle found
-    }
-    
-    }
+#include "Algorithms.hpp"
+#include <vector>
+#include <climits>
+#include <functional>
+#include <charconv>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <random>
+#include <unordered_map>
+#include <type_traits>
+#include <cstdint>
+#include "Parallel.hpp"
+
+namespace ariel {
+    namespace {
+        // Neighbour access over the dense adjacency matrix, matching CompressedGraph::forEachNeighbor
+        struct DenseAdjacency {
+            const std::vector<std::vector<int>>& matrix;
+
+            explicit DenseAdjacency(const Graph& g) : matrix(g.getAdjacencyMatrix()) {}
+
+            int getNumVertices() const { return matrix.size(); }
+
+            int getDegree(int u) const {
+                return matrix[u].size() - std::count(matrix[u].begin(), matrix[u].end(), 0);
+            }
+
+            template <typename Visitor>
+            void forEachNeighbor(int u, Visitor visit) const {
+                const std::vector<int>& row = matrix[u];
+                int numVertices = row.size();
+                for (int v = 0; v < numVertices; ++v) {
+                    if (row[v] != 0) visit(v, row[v]);
+                }
+            }
+        };
+
+        // In-neighbours from a column scan of the dense matrix
+        struct DenseReverseAdjacency {
+            const std::vector<std::vector<int>>& matrix;
+
+            explicit DenseReverseAdjacency(const Graph& g) : matrix(g.getAdjacencyMatrix()) {}
+
+            int getNumVertices() const { return matrix.size(); }
+
+            template <typename Visitor>
+            void forEachNeighbor(int v, Visitor visit) const {
+                int numVertices = matrix.size();
+                for (int u = 0; u < numVertices; ++u) {
+                    if (matrix[u][v] != 0) visit(u, matrix[u][v]);
+                }
+            }
+
+            // First in-neighbour accepted by the predicate, or -1
+            template <typename Predicate>
+            int findNeighbor(int v, Predicate accept) const {
+                int numVertices = matrix.size();
+                for (int u = 0; u < numVertices; ++u) {
+                    if (matrix[u][v] != 0 && accept(u)) return u;
+                }
+                return -1;
+            }
+        };
+
+        // Neighbour access over the cached CSR view of a graph
+        struct CsrAdjacency {
+            const AdjacencyList& list;
+
+            explicit CsrAdjacency(const Graph& g) : list(g.getAdjacencyList()) {}
+            explicit CsrAdjacency(const AdjacencyList& list) : list(list) {}
+
+            int getNumVertices() const { return list.offsets.size() - 1; }
+
+            int getDegree(int u) const { return list.offsets[u + 1] - list.offsets[u]; }
+
+            template <typename Visitor>
+            void forEachNeighbor(int u, Visitor visit) const {
+                for (int e = list.offsets[u]; e < list.offsets[u + 1]; ++e) {
+                    visit(list.targets[e], list.weights[e]);
+                }
+            }
+
+            // First neighbour accepted by the predicate, or -1
+            template <typename Predicate>
+            int findNeighbor(int u, Predicate accept) const {
+                for (int e = list.offsets[u]; e < list.offsets[u + 1]; ++e) {
+                    if (accept(list.targets[e])) return list.targets[e];
+                }
+                return -1;
+            }
+        };
+
+        // Fixed-size set of vertex ids, one bit each
+        class Bitmap {
+        public:
+            void reset(int size) { words.assign((static_cast<size_t>(size) + 63) / 64, 0); }
+            bool test(int v) const { return (words[v >> 6] >> (v & 63)) & 1; }
+            void set(int v) { words[v >> 6] |= uint64_t(1) << (v & 63); }
+            void clear() { std::fill(words.begin(), words.end(), 0); }
+            void swap(Bitmap& other) { words.swap(other.words); }
+
+        private:
+            std::vector<uint64_t> words;
+        };
+
+        // Direction-optimizing BFS (Beamer et al.). Top-down steps push from a queue
+        // of frontier vertices along out-edges. Bottom-up steps let every unvisited
+        // vertex look for a parent among its in-neighbours in the frontier bitmap and
+        // stop at the first hit, which skips most edge checks once the frontier is a
+        // large part of the graph. The search turns bottom-up when the frontier's
+        // out-edges exceed 1/Alpha of the unexplored ones, and top-down again once the
+        // frontier drops below 1/Beta of the vertices. Without an in-neighbour view
+        // (in == nullptr) every step is top-down.
+        //
+        // Successive runs only visit vertices earlier runs have not, so calling run
+        // on every unvisited vertex covers the graph once. Levels count from the
+        // source of the run that reached each vertex; -1 means not reached yet.
+        template <typename Out, typename In>
+        class BreadthFirstSearch {
+        public:
+            static const int Alpha = 15;
+            static const int Beta = 18;
+
+            BreadthFirstSearch(const Out& out, const In* in, std::vector<int>& levels, std::vector<int>& parents)
+                : out(out), in(in), numVertices(out.getNumVertices()), levels(levels), parents(parents),
+                  degree(numVertices), unexploredEdges(0) {
+                for (int u = 0; u < numVertices; ++u) {
+                    degree[u] = out.getDegree(u);
+                    unexploredEdges += degree[u];
+                }
+                levels.assign(numVertices, -1);
+                parents.assign(numVertices, -1);
+                visited.reset(numVertices);
+                frontierBits.reset(numVertices);
+                nextBits.reset(numVertices);
+            }
+
+            bool isVisited(int v) const { return visited.test(v); }
+
+            // Returns the number of vertices this run reached, source included
+            int run(int source) {
+                if (visited.test(source)) return 0;
+                queue.assign(1, source);
+                discover(source, -1, 0);
+                int reached = 1;
+                long long frontierEdges = degree[source];
+                bool bottomUp = false;
+                for (int depth = 0; ; ++depth) {
+                    if (!bottomUp && in != nullptr && frontierEdges > unexploredEdges / Alpha) {
+                        bottomUp = true;
+                        frontierBits.clear();
+                        for (int u : queue) frontierBits.set(u);
+                    }
+                    int count = 0;
+                    frontierEdges = 0;
+                    if (bottomUp) {
+                        nextBits.clear();
+                        for (int v = 0; v < numVertices; ++v) {
+                            if (visited.test(v)) continue;
+                            int parent = in->findNeighbor(v, [&](int u) { return frontierBits.test(u); });
+                            if (parent == -1) continue;
+                            discover(v, parent, depth + 1);
+                            nextBits.set(v);
+                            frontierEdges += degree[v];
+                            ++count;
+                        }
+                        frontierBits.swap(nextBits);
+                        if (count > 0 && count < numVertices / Beta) {
+                            bottomUp = false;
+                            queue.clear();
+                            for (int v = 0; v < numVertices; ++v) {
+                                if (frontierBits.test(v)) queue.push_back(v);
+                            }
+                        }
+                    } else {
+                        next.clear();
+                        for (int u : queue) {
+                            out.forEachNeighbor(u, [&](int v, int) {
+                                if (visited.test(v)) return;
+                                discover(v, u, depth + 1);
+                                next.push_back(v);
+                                frontierEdges += degree[v];
+                            });
+                        }
+                        count = next.size();
+                        queue.swap(next);
+                    }
+                    if (count == 0) break;
+                    reached += count;
+                }
+                return reached;
+            }
+
+        private:
+            void discover(int v, int parent, int level) {
+                visited.set(v);
+                levels[v] = level;
+                parents[v] = parent;
+                unexploredEdges -= degree[v];
+            }
+
+            const Out& out;
+            const In* in;
+            int numVertices;
+            std::vector<int>& levels;
+            std::vector<int>& parents;
+            std::vector<int> degree;
+            long long unexploredEdges;
+            Bitmap visited;
+            Bitmap frontierBits;
+            Bitmap nextBits;
+            std::vector<int> queue;
+            std::vector<int> next;
+        };
+
+        void appendInt(std::string& out, long long value) {
+            char digits[24];
+            out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+        }
+
+        // Per-thread buffers reused across shortest-path queries
+        struct PathScratch {
+            std::vector<long long> distances;
+            std::vector<int> parents;
+            std::vector<char> settled;
+            std::vector<std::pair<long long, int>> heap;
+            std::vector<int> cycle;
+        };
+        thread_local PathScratch pathScratch;
+
+        // Fills result from the parent chain ending at end
+        void tracePath(const std::vector<long long>& distances, const std::vector<int>& parents, int start, int end, PathResult& result) {
+            result.path.clear();
+            if (distances[end] == LLONG_MAX) {
+                result.status = PathStatus::NoPath;
+                return;
+            }
+            for (int at = end; at != -1; at = parents[at]) {
+                result.path.push_back(at);
+                if (at == start) break;  // Stop if we've reached the start
+            }
+            std::reverse(result.path.begin(), result.path.end());
+            result.status = PathStatus::Found;
+            result.distance = distances[end];
+        }
+
+        // Dijkstra with an O(V) array scan per step, the best choice for dense matrices.
+        // Stops as soon as end is settled (end == -1 computes the whole tree).
+        void dijkstraDense(const Graph& g, int start, int end, std::vector<long long>& distances, std::vector<int>& parents) {
+            int numVertices = g.getNumVertices();
+            const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
+            std::vector<char>& settled = pathScratch.settled;
+            distances.assign(numVertices, LLONG_MAX);
+            parents.assign(numVertices, -1);
+            settled.assign(numVertices, false);
+            distances[start] = 0;
+
+            for (int step = 0; step < numVertices; ++step) {
+                int u = -1;
+                for (int v = 0; v < numVertices; ++v) {
+                    if (!settled[v] && distances[v] != LLONG_MAX && (u == -1 || distances[v] < distances[u])) {
+                        u = v;
+                    }
+                }
+                if (u == -1 || u == end) break;
+                settled[u] = true;
+
+                const std::vector<int>& row = adjacencyMatrix[u];
+                for (int v = 0; v < numVertices; ++v) {
+                    if (row[v] != 0 && !settled[v] && distances[u] + row[v] < distances[v]) {
+                        distances[v] = distances[u] + row[v];
+                        parents[v] = u;
+                    }
+                }
+            }
+        }
+
+        // Dijkstra with a binary heap for sparse adjacency lists.
+        // Stops as soon as end is settled (end == -1 computes the whole tree).
+        template <typename Adjacency>
+        void dijkstraHeap(const Adjacency& adj, int start, int end, std::vector<long long>& distances, std::vector<int>& parents) {
+            int numVertices = adj.getNumVertices();
+            std::vector<std::pair<long long, int>>& heap = pathScratch.heap;
+            typedef std::greater<std::pair<long long, int>> MinFirst;
+            distances.assign(numVertices, LLONG_MAX);
+            parents.assign(numVertices, -1);
+            heap.clear();
+            distances[start] = 0;
+            heap.push_back({0, start});
+
+            while (!heap.empty()) {
+                std::pop_heap(heap.begin(), heap.end(), MinFirst());
+                std::pair<long long, int> top = heap.back();
+                heap.pop_back();
+                int u = top.second;
+                if (top.first != distances[u]) continue; // stale entry
+                if (u == end) break;
+                adj.forEachNeighbor(u, [&](int v, long long weight) {
+                    if (distances[u] + weight < distances[v]) {
+                        distances[v] = distances[u] + weight;
+                        parents[v] = u;
+                        heap.push_back({distances[v], v});
+                        std::push_heap(heap.begin(), heap.end(), MinFirst());
+                    }
+                });
+            }
+        }
+
+        // Two-colours every BFS tree by level parity, then checks that no edge joins
+        // vertices of the same colour
+        template <typename Out, typename In>
+        bool isBipartiteImpl(const Out& out, const In* in, std::vector<int>& color) {
+            int numVertices = out.getNumVertices();
+            std::vector<int> parents;
+            BreadthFirstSearch<Out, In> bfs(out, in, color, parents);
+            for (int start = 0; start < numVertices; ++start) {
+                bfs.run(start);
+            }
+            for (int v = 0; v < numVertices; ++v) {
+                color[v] &= 1;
+            }
+            for (int u = 0; u < numVertices; ++u) {
+                bool conflict = false;
+                out.forEachNeighbor(u, [&](int v, int) {
+                    if (color[v] == color[u]) conflict = true;
+                });
+                if (conflict) return false;
+            }
+            return true;
+        }
+
+        std::string formatBipartition(bool bipartite, const std::vector<int>& color) {
+            if (!bipartite) {
+                return "The graph is not bipartite.";
+            }
+            // Show the two sets, A = color 0 and B = color 1
+            std::string out = "The graph is bipartite: A={";
+            for (int side = 0; side < 2; ++side) {
+                bool first = true;
+                for (size_t i = 0; i < color.size(); ++i) {
+                    if (color[i] != side) continue;
+                    if (!first) out += ", ";
+                    appendInt(out, i);
+                    first = false;
+                }
+                out += side == 0 ? "}, B={" : "}.";
+            }
+            return out;
+        }
+
+        // Iterative Tarjan. Each DFS frame owns a range of the pending stack holding
+        // the neighbours it has yet to descend into; neighbours already on the SCC
+        // stack update low immediately, which is equivalent because they cannot
+        // leave the stack before the current vertex finishes. Components are
+        // numbered as they complete, i.e. in reverse topological order.
+        template <typename Adjacency>
+        int tarjanImpl(const Adjacency& adj, std::vector<int>& component) {
+            int numVertices = adj.getNumVertices();
+            component.assign(numVertices, -1);
+            std::vector<int> index(numVertices, -1);
+            std::vector<int> low(numVertices, 0);
+            std::vector<int> stack;
+            std::vector<int> pending;
+            std::vector<std::pair<int, size_t>> frames; // (vertex, first pending entry)
+            int counter = 0;
+            int count = 0;
+
+            auto visit = [&](int u) {
+                index[u] = low[u] = counter++;
+                stack.push_back(u);
+                frames.push_back({u, pending.size()});
+                adj.forEachNeighbor(u, [&](int v, int) {
+                    if (index[v] == -1) {
+                        pending.push_back(v);
+                    } else if (component[v] == -1) {
+                        low[u] = std::min(low[u], index[v]);
+                    }
+                });
+            };
+
+            for (int root = 0; root < numVertices; ++root) {
+                if (index[root] != -1) continue;
+                visit(root);
+                while (!frames.empty()) {
+                    int u = frames.back().first;
+                    if (pending.size() > frames.back().second) {
+                        int v = pending.back();
+                        pending.pop_back();
+                        if (index[v] == -1) {
+                            visit(v);
+                        } else if (component[v] == -1) {
+                            low[u] = std::min(low[u], index[v]);
+                        }
+                        continue;
+                    }
+                    frames.pop_back();
+                    if (low[u] == index[u]) {
+                        int v;
+                        do {
+                            v = stack.back();
+                            stack.pop_back();
+                            component[v] = count;
+                        } while (v != u);
+                        ++count;
+                    }
+                    if (!frames.empty()) {
+                        int parent = frames.back().first;
+                        low[parent] = std::min(low[parent], low[u]);
+                    }
+                }
+            }
+            return count;
+        }
+
+        // If some vertex reaches every vertex, the source of the last BFS started by
+        // a sweep over all vertices is one: every earlier tree is closed under
+        // reachability, so it cannot contain such a vertex. A second BFS checks it.
+        template <typename Out, typename In>
+        int findRootImpl(const Out& out, const In* in) {
+            int numVertices = out.getNumVertices();
+            std::vector<int> levels;
+            std::vector<int> parents;
+            int candidate = -1;
+            {
+                BreadthFirstSearch<Out, In> sweep(out, in, levels, parents);
+                for (int v = 0; v < numVertices; ++v) {
+                    if (sweep.run(v) > 0) candidate = v;
+                }
+            }
+            if (candidate == -1) return -1;
+            BreadthFirstSearch<Out, In> check(out, in, levels, parents);
+            return check.run(candidate) == numVertices ? candidate : -1;
+        }
+
+        // True when some vertex with outgoing edges reaches every vertex
+        template <typename Out, typename In>
+        bool isConnectedImpl(const Out& out, const In* in) {
+            int root = findRootImpl(out, in);
+            return root != -1 && out.getDegree(root) > 0;
+        }
+
+        // Union-find over every edge regardless of direction; ids follow the smallest vertex
+        template <typename Adjacency>
+        int weakComponentsImpl(const Adjacency& adj, std::vector<int>& component) {
+            int numVertices = adj.getNumVertices();
+            std::vector<int> parent(numVertices);
+            for (int v = 0; v < numVertices; ++v) parent[v] = v;
+            auto find = [&](int v) {
+                while (parent[v] != v) {
+                    parent[v] = parent[parent[v]];
+                    v = parent[v];
+                }
+                return v;
+            };
+            for (int u = 0; u < numVertices; ++u) {
+                adj.forEachNeighbor(u, [&](int v, int) {
+                    int a = find(u);
+                    int b = find(v);
+                    if (a != b) parent[std::max(a, b)] = std::min(a, b);
+                });
+            }
+            component.assign(numVertices, -1);
+            int count = 0;
+            for (int v = 0; v < numVertices; ++v) {
+                int root = find(v);
+                if (component[root] == -1) component[root] = count++;
+                component[v] = component[root];
+            }
+            return count;
+        }
+
+        // Afforest connected components (Sutton et al.) over edges of either direction.
+        // Every vertex starts as its own root; links hook the larger root under the
+        // smaller with a CAS, so no locks are needed. The first NeighborRounds
+        // neighbours of every vertex are linked round by round, then a sample finds
+        // the component that already holds most vertices; vertices in it skip the
+        // rest of their edges, since an edge to them is also seen from the other end.
+        // That needs in-edges for directed graphs, which reverse provides (nullptr
+        // when the storage has none, in which case no vertex is skipped).
+        const int NeighborRounds = 2;
+        const int SampleCount = 1024;
+
+        template <typename Adjacency, typename Reverse>
+        int afforestImpl(const Adjacency& adj, const Reverse* reverse, unsigned threads,
+                         std::vector<int>& component, std::vector<int>& sizes) {
+            int numVertices = adj.getNumVertices();
+            std::vector<std::atomic<int>> parent(numVertices);
+            for (int v = 0; v < numVertices; ++v) {
+                parent[v].store(v, std::memory_order_relaxed);
+            }
+
+            for (int round = 0; round < NeighborRounds; ++round) {
+                parallelFor(0, numVertices, threads, [&](unsigned, int begin, int end) {
+                    for (int u = begin; u < end; ++u) {
+                        int seen = 0;
+                        adj.forEachNeighbor(u, [&](int v, int) {
+                            if (seen++ == round) linkComponents(parent, u, v);
+                        });
+                    }
+                });
+                compressComponents(parent, threads);
+            }
+
+            // Most frequent root among a fixed pseudo-random sample
+            int largest = -1;
+            if (reverse != nullptr && numVertices > 0) {
+                std::unordered_map<int, int> counts;
+                std::mt19937 random(12345);
+                std::uniform_int_distribution<int> pick(0, numVertices - 1);
+                int best = 0;
+                for (int i = 0; i < SampleCount; ++i) {
+                    int root = parent[pick(random)].load(std::memory_order_relaxed);
+                    if (++counts[root] > best) {
+                        best = counts[root];
+                        largest = root;
+                    }
+                }
+            }
+
+            parallelFor(0, numVertices, threads, [&](unsigned, int begin, int end) {
+                for (int u = begin; u < end; ++u) {
+                    if (largest != -1 && findComponentRoot(parent, u) == largest) continue;
+                    int seen = 0;
+                    adj.forEachNeighbor(u, [&](int v, int) {
+                        if (seen++ >= NeighborRounds) linkComponents(parent, u, v);
+                    });
+                    if (largest != -1) {
+                        reverse->forEachNeighbor(u, [&](int v, int) { linkComponents(parent, u, v); });
+                    }
+                }
+            });
+            compressComponents(parent, threads);
+
+            // Compact ids in order of each component's smallest vertex
+            component.assign(numVertices, -1);
+            sizes.clear();
+            for (int v = 0; v < numVertices; ++v) {
+                int root = parent[v].load(std::memory_order_relaxed);
+                if (component[root] == -1) {
+                    component[root] = sizes.size();
+                    sizes.push_back(0);
+                }
+                component[v] = component[root];
+                ++sizes[component[v]];
+            }
+            return sizes.size();
+        }
+
+        // Two-colouring of the underlying undirected graph. Afforest finds the
+        // components, then one level-synchronous BFS starts from the smallest vertex
+        // of every component at once, so small components are coloured side by side
+        // and large frontiers are split across threads; vertices are claimed with a
+        // CAS on their level. Colours are level parities, which match the sequential
+        // isBipartite on undirected graphs. A conflict edge joins two vertices of
+        // equal parity; walking both tree paths up to their common ancestor closes an
+        // odd cycle through it. in supplies in-edges for directed graphs (nullptr
+        // when every edge is stored in both directions).
+        template <typename Out, typename In>
+        void parallelBipartitionImpl(const Out& out, const In* in, unsigned threads, BipartiteResult& result) {
+            int numVertices = out.getNumVertices();
+            unsigned workers = resolveThreads(threads);
+            std::vector<int> components;
+            std::vector<int> sizes;
+            afforestImpl(out, in, threads, components, sizes);
+
+            std::vector<std::atomic<int>> level(numVertices);
+            std::vector<int> parents(numVertices, -1);
+            std::vector<int> frontier;
+            std::vector<char> seeded(sizes.size(), false);
+            for (int v = 0; v < numVertices; ++v) {
+                bool root = !seeded[components[v]];
+                seeded[components[v]] = true;
+                level[v].store(root ? 0 : -1, std::memory_order_relaxed);
+                if (root) frontier.push_back(v);
+            }
+
+            std::vector<std::vector<int>> next(workers);
+            for (int depth = 0; !frontier.empty(); ++depth) {
+                parallelFor(0, static_cast<int>(frontier.size()), workers, [&](unsigned thread, int begin, int end) {
+                    std::vector<int>& mine = next[thread];
+                    auto claim = [&](int u, int v) {
+                        int unvisited = -1;
+                        if (level[v].load(std::memory_order_relaxed) == -1 &&
+                            level[v].compare_exchange_strong(unvisited, depth + 1, std::memory_order_relaxed)) {
+                            parents[v] = u;
+                            mine.push_back(v);
+                        }
+                    };
+                    for (int i = begin; i < end; ++i) {
+                        int u = frontier[i];
+                        out.forEachNeighbor(u, [&](int v, int) { claim(u, v); });
+                        if (in != nullptr) in->forEachNeighbor(u, [&](int v, int) { claim(u, v); });
+                    }
+                });
+                frontier.clear();
+                for (std::vector<int>& mine : next) {
+                    frontier.insert(frontier.end(), mine.begin(), mine.end());
+                    mine.clear();
+                }
+            }
+
+            // Smallest conflicting (u, v), found in parallel; every edge is an out-edge of its tail
+            std::vector<std::pair<int, int>> conflicts(workers, std::make_pair(-1, -1));
+            parallelFor(0, numVertices, workers, [&](unsigned thread, int begin, int end) {
+                for (int u = begin; u < end && conflicts[thread].first == -1; ++u) {
+                    int parity = level[u].load(std::memory_order_relaxed) & 1;
+                    out.forEachNeighbor(u, [&](int v, int) {
+                        if (conflicts[thread].first == -1 && (level[v].load(std::memory_order_relaxed) & 1) == parity) {
+                            conflicts[thread] = {u, v};
+                        }
+                    });
+                }
+            });
+
+            result.colors.resize(numVertices);
+            for (int v = 0; v < numVertices; ++v) {
+                result.colors[v] = level[v].load(std::memory_order_relaxed) & 1;
+            }
+            result.conflictEdge = {-1, -1};
+            result.oddCycle.clear();
+            for (const std::pair<int, int>& conflict : conflicts) {
+                if (conflict.first != -1) {
+                    result.conflictEdge = conflict;
+                    break;
+                }
+            }
+            result.bipartite = result.conflictEdge.first == -1;
+            if (result.bipartite) return;
+
+            int a = result.conflictEdge.first;
+            int b = result.conflictEdge.second;
+            std::vector<int> towardB;
+            while (level[a].load(std::memory_order_relaxed) > level[b].load(std::memory_order_relaxed)) {
+                result.oddCycle.push_back(a);
+                a = parents[a];
+            }
+            while (level[b].load(std::memory_order_relaxed) > level[a].load(std::memory_order_relaxed)) {
+                towardB.push_back(b);
+                b = parents[b];
+            }
+            while (a != b) {
+                result.oddCycle.push_back(a);
+                towardB.push_back(b);
+                a = parents[a];
+                b = parents[b];
+            }
+            // Ancestor first, then down to u, then from v back up towards the ancestor
+            result.oddCycle.push_back(a);
+            std::reverse(result.oddCycle.begin(), result.oddCycle.end());
+            result.oddCycle.insert(result.oddCycle.end(), towardB.begin(), towardB.end());
+        }
+
+        // Buffers reused by cycle searches on the same thread
+        struct CycleScratch {
+            std::vector<char> color;          // 0 = unvisited, 1 = on the DFS path, 2 = finished
+            std::vector<int> position;        // index in path of each on-path vertex
+            std::vector<int> path;
+            std::vector<size_t> pendingBegin; // per path entry, its first pending neighbour
+            std::vector<int> pending;
+        };
+        thread_local CycleScratch cycleScratch;
+
+        // Iterative three-colour DFS. In a directed graph an edge into a vertex on the
+        // current path closes a cycle; in an undirected one any edge other than the one
+        // back to the parent does, since undirected DFS has no cross edges. Neighbours
+        // are examined when a vertex is entered and the unvisited ones wait on the
+        // pending stack; one that has been reached by the time it is popped is already
+        // finished, so it needs no second look. The cycle is returned in edge order,
+        // starting at the vertex the closing edge points to.
+        template <typename Adjacency>
+        bool findCycleImpl(const Adjacency& adj, bool directed, std::vector<int>& cycle) {
+            int numVertices = adj.getNumVertices();
+            CycleScratch& scratch = cycleScratch;
+            scratch.color.assign(numVertices, 0);
+            scratch.position.resize(numVertices);
+            scratch.path.clear();
+            scratch.pendingBegin.clear();
+            scratch.pending.clear();
+            cycle.clear();
+            int closing = -1;
+
+            auto enter = [&](int u) {
+                int parent = scratch.path.empty() ? -1 : scratch.path.back();
+                scratch.color[u] = 1;
+                scratch.position[u] = scratch.path.size();
+                scratch.path.push_back(u);
+                scratch.pendingBegin.push_back(scratch.pending.size());
+                adj.forEachNeighbor(u, [&](int v, int) {
+                    if (closing != -1) return;
+                    if (scratch.color[v] == 0) {
+                        scratch.pending.push_back(v);
+                    } else if (scratch.color[v] == 1 && (directed || v != parent)) {
+                        closing = v;
+                    }
+                });
+                // Pop in increasing order of id, the order a recursive DFS would follow
+                std::reverse(scratch.pending.begin() + scratch.pendingBegin.back(), scratch.pending.end());
+                return closing != -1;
+            };
+
+            for (int root = 0; root < numVertices && closing == -1; ++root) {
+                if (scratch.color[root] != 0 || enter(root)) continue;
+                while (!scratch.path.empty()) {
+                    if (scratch.pending.size() > scratch.pendingBegin.back()) {
+                        int v = scratch.pending.back();
+                        scratch.pending.pop_back();
+                        if (scratch.color[v] == 0 && enter(v)) break;
+                    } else {
+                        scratch.color[scratch.path.back()] = 2;
+                        scratch.path.pop_back();
+                        scratch.pendingBegin.pop_back();
+                    }
+                }
+            }
+            if (closing == -1) return false;
+            cycle.assign(scratch.path.begin() + scratch.position[closing], scratch.path.end());
+            return true;
+        }
+
+        // Calls body(out, in) with the CSR views on sparse graphs and the matrix on dense
+        // ones; in points at the matching in-neighbour view
+        template <typename Body>
+        auto withAdjacency(const Graph& g, Body body) -> decltype(body(DenseAdjacency(g), static_cast<const DenseReverseAdjacency*>(nullptr))) {
+            long long numVertices = g.getNumVertices();
+            if (static_cast<long long>(g.getAdjacencyList().targets.size()) * 8 < numVertices * numVertices) {
+                CsrAdjacency in(g.getReverseAdjacencyList());
+                return body(CsrAdjacency(g), &in);
+            }
+            DenseReverseAdjacency in(g);
+            return body(DenseAdjacency(g), &in);
+        }
+
+        // Finds a cycle among the parent pointers (edges parent[v] -> v) and returns
+        // it in edge order, rotated to start at its smallest vertex
+        bool findParentCycle(const std::vector<int>& parents, std::vector<int>& cycle) {
+            int numVertices = parents.size();
+            std::vector<int> walk(numVertices, -1); // id of the walk that first reached each vertex
+            for (int start = 0; start < numVertices; ++start) {
+                int v = start;
+                while (v != -1 && walk[v] == -1) {
+                    walk[v] = start;
+                    v = parents[v];
+                }
+                if (v == -1 || walk[v] != start) continue;
+
+                // v lies on a cycle reached by this walk
+                cycle.clear();
+                int at = v;
+                do {
+                    cycle.push_back(at);
+                    at = parents[at];
+                } while (at != v);
+                std::reverse(cycle.begin(), cycle.end());
+                std::rotate(cycle.begin(), std::min_element(cycle.begin(), cycle.end()), cycle.end());
+                return true;
+            }
+            return false;
+        }
+
+        // Queue-based Bellman-Ford (SPFA). Only out-edges of vertices whose distance
+        // changed are relaxed, so it stops as soon as a round changes nothing.
+        // A vertex improved numVertices times implies a negative cycle, which is
+        // confirmed (and returned in cycle) by finding a cycle in the parent graph;
+        // the check is repeated every numVertices improvements until one shows up.
+        // source == -1 starts from a virtual super-source with a 0-weight edge to
+        // every vertex, i.e. all vertices start at distance 0 with no parent.
+        template <typename Adjacency>
+        bool spfa(const Adjacency& adj, int source, std::vector<long long>& distances, std::vector<int>& parents, std::vector<int>& cycle) {
+            int numVertices = adj.getNumVertices();
+            distances.assign(numVertices, LLONG_MAX);
+            parents.assign(numVertices, -1);
+            std::vector<int> improvements(numVertices, 0);
+            std::vector<bool> queued(numVertices, false);
+            std::queue<int> queue;
+            for (int v = 0; v < numVertices; ++v) {
+                if (source == -1 || v == source) {
+                    distances[v] = 0;
+                    queue.push(v);
+                    queued[v] = true;
+                }
+            }
+            bool suspect = false;
+            long long relaxed = 0;
+            long long nextCheck = 0;
+
+            while (!queue.empty()) {
+                int u = queue.front();
+                queue.pop();
+                queued[u] = false;
+                adj.forEachNeighbor(u, [&](int v, int weight) {
+                    if (distances[u] + weight < distances[v]) {
+                        distances[v] = distances[u] + weight;
+                        parents[v] = u;
+                        ++relaxed;
+                        if (++improvements[v] >= numVertices) suspect = true;
+                        if (!queued[v]) {
+                            queued[v] = true;
+                            queue.push(v);
+                        }
+                    }
+                });
+                if (suspect && relaxed >= nextCheck) {
+                    if (findParentCycle(parents, cycle)) return true;
+                    nextCheck = relaxed + numVertices;
+                }
+            }
+            return false;
+        }
+
+        // Least-recently-used results keyed by (graph version, key). A modified graph
+        // has a new version, so results for its old contents just age out. capacity
+        // bounds the total cost of the entries, which is 1 each unless insert is
+        // given a size. Lookups go through a hash index and are safe from any thread.
+        template <typename Value>
+        class VersionedCache {
+        public:
+            explicit VersionedCache(size_t capacity) : capacity(capacity), used(0) {}
+
+            std::shared_ptr<const Value> find(unsigned long long version, int key) {
+                std::lock_guard<std::mutex> lock(mutex);
+                typename Index::iterator found = index.find({version, key});
+                if (found == index.end()) {
+                    return nullptr;
+                }
+                entries.splice(entries.begin(), entries, found->second);
+                return found->second->value;
+            }
+
+            void insert(unsigned long long version, int key, std::shared_ptr<const Value> value, size_t cost = 1) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (cost > capacity) return;
+                typename Index::iterator found = index.find({version, key});
+                if (found != index.end()) {
+                    used -= found->second->cost;
+                    entries.erase(found->second);
+                }
+                entries.push_front({version, key, std::move(value), cost});
+                index[{version, key}] = entries.begin();
+                used += cost;
+                trim();
+            }
+
+            void setCapacity(size_t newCapacity) {
+                std::lock_guard<std::mutex> lock(mutex);
+                capacity = newCapacity;
+                trim();
+            }
+
+        private:
+            struct Entry {
+                unsigned long long version;
+                int key;
+                std::shared_ptr<const Value> value;
+                size_t cost;
+            };
+
+            struct KeyHash {
+                size_t operator()(const std::pair<unsigned long long, int>& k) const {
+                    return std::hash<unsigned long long>()(k.first * 0x9e3779b97f4a7c15ull ^ static_cast<unsigned>(k.second));
+                }
+            };
+            typedef std::unordered_map<std::pair<unsigned long long, int>, typename std::list<Entry>::iterator, KeyHash> Index;
+
+            void trim() {
+                while (used > capacity) {
+                    used -= entries.back().cost;
+                    index.erase({entries.back().version, entries.back().key});
+                    entries.pop_back();
+                }
+            }
+
+            std::mutex mutex;
+            std::list<Entry> entries; // most recently used first
+            Index index;
+            size_t capacity;
+            size_t used;
+        };
+
+        VersionedCache<ShortestPathTree>& treeCache() {
+            static VersionedCache<ShortestPathTree> cache(32);
+            return cache;
+        }
+
+        // Yes/no graph properties with the vertices that show it (the colouring, the
+        // cycle) and the text the string API returns, memoized per graph version under
+        // a byte budget
+        enum Property { Connected, Bipartite, HasCycle, HasNegativeCycle };
+
+        struct PropertyResult {
+            bool holds = false;
+            std::vector<int> witness;
+            std::string text;
+        };
+
+        const size_t DefaultPropertyBudget = 4 << 20;
+
+        VersionedCache<PropertyResult>& propertyCache() {
+            static VersionedCache<PropertyResult> cache(DefaultPropertyBudget);
+            return cache;
+        }
+
+        // The text is formatted once, when the result is computed, so a hit costs a lookup
+        template <typename Compute, typename Format>
+        std::shared_ptr<const PropertyResult> memoized(const Graph& g, Property property, Compute compute, Format format) {
+            std::shared_ptr<const PropertyResult> cached = propertyCache().find(g.getVersion(), property);
+            if (!cached) {
+                std::shared_ptr<PropertyResult> computed = std::make_shared<PropertyResult>();
+                computed->holds = compute(computed->witness);
+                computed->text = format(computed->holds, computed->witness);
+                size_t cost = sizeof(PropertyResult) + computed->witness.size() * sizeof(int) + computed->text.size();
+                propertyCache().insert(g.getVersion(), property, computed, cost);
+                cached = computed;
+            }
+            return cached;
+        }
+
+        std::string noText(bool, const std::vector<int>&) {
+            return std::string();
+        }
+
+        // "0" when there is no cycle, else the cycle closed back to its first vertex
+        std::string formatCycle(bool found, const std::vector<int>& cycle) {
+            return found ? Algorithms::formatPath(cycle, true) : "0";
+        }
+
+        struct Potentials;
+        VersionedCache<Potentials>& potentialsCache();
+
+        // Johnson potentials: distances from a virtual super-source with a 0-weight
+        // edge to every vertex. w(u, v) + values[u] - values[v] is never negative.
+        struct Potentials {
+            bool negativeCycle = false;
+            std::vector<long long> values;
+        };
+
+        std::shared_ptr<const Potentials> potentialsFor(const Graph& g) {
+            std::shared_ptr<const Potentials> cached = potentialsCache().find(g.getVersion(), 0);
+            if (!cached) {
+                std::shared_ptr<Potentials> computed = std::make_shared<Potentials>();
+                std::vector<int> parents;
+                computed->negativeCycle = spfa(CsrAdjacency(g), -1, computed->values, parents, pathScratch.cycle);
+                potentialsCache().insert(g.getVersion(), 0, computed);
+                cached = computed;
+            }
+            return cached;
+        }
+
+        VersionedCache<Potentials>& potentialsCache() {
+            static VersionedCache<Potentials> cache(8);
+            return cache;
+        }
+
+        // CSR neighbours with Johnson-reweighted, non-negative edge weights
+        struct ReweightedAdjacency {
+            CsrAdjacency base;
+            const std::vector<long long>& potentials;
+
+            ReweightedAdjacency(const Graph& g, const std::vector<long long>& potentials) : base(g), potentials(potentials) {}
+
+            int getNumVertices() const { return base.getNumVertices(); }
+
+            template <typename Visitor>
+            void forEachNeighbor(int u, Visitor visit) const {
+                base.forEachNeighbor(u, [&](int v, int weight) {
+                    visit(v, weight + potentials[u] - potentials[v]);
+                });
+            }
+        };
+
+        // Dijkstra over reweighted edges, with distances mapped back to the original weights
+        void reweightedDijkstra(const Graph& g, const std::vector<long long>& potentials, int start, int end,
+                                std::vector<long long>& distances, std::vector<int>& parents) {
+            dijkstraHeap(ReweightedAdjacency(g, potentials), start, end, distances, parents);
+            for (size_t v = 0; v < distances.size(); ++v) {
+                if (distances[v] != LLONG_MAX) distances[v] += potentials[v] - potentials[start];
+            }
+        }
+
+        // Delta-stepping over any adjacency view with non-negative weights. Vertices are
+        // owned round-robin by the threads; each thread keeps its own ring of buckets
+        // of width delta and is the only one to touch its vertices' distances, so
+        // relaxations are sent as requests to the owner's inbox between barriers.
+        // A bucket is emptied by repeated light-edge (weight <= delta) rounds, after
+        // which the heavy edges of everything settled in it are relaxed once.
+        template <typename Adjacency>
+        void deltaStepping(const Adjacency& adj, int source, long long delta, long long maxWeight, unsigned threads,
+                           std::vector<long long>& distances, std::vector<int>& parents) {
+            int numVertices = adj.getNumVertices();
+            int workers = static_cast<int>(std::min<unsigned>(resolveThreads(threads), numVertices));
+            size_t ringSize = static_cast<size_t>(maxWeight / delta) + 2;
+            distances.assign(numVertices, LLONG_MAX);
+            parents.assign(numVertices, -1);
+
+            struct Request {
+                int target;
+                int from;
+                long long distance;
+            };
+            struct Worker {
+                std::vector<std::vector<int>> buckets;      // ring indexed by bucket % ringSize
+                std::vector<int> frontier;
+                std::vector<int> settled;                    // vertices removed from the current bucket
+                std::vector<std::vector<Request>> outbox;    // requests per owner thread
+                long long nextBucket = LLONG_MAX;
+                bool active = false;
+            };
+            std::vector<Worker> state(workers);
+            for (Worker& worker : state) {
+                worker.buckets.resize(ringSize);
+                worker.outbox.resize(workers);
+            }
+            std::vector<long long> queuedIn(numVertices, -1); // bucket holding a live entry for v
+            Barrier barrier(workers);
+
+            distances[source] = 0;
+            queuedIn[source] = 0;
+            state[source % workers].buckets[0].push_back(source);
+
+            parallelFor(0, workers, workers, [&](unsigned, int self, int) {
+                Worker& mine = state[self];
+                auto relax = [&](int u, bool light) {
+                    adj.forEachNeighbor(u, [&](int v, long long weight) {
+                        if ((weight <= delta) == light) {
+                            mine.outbox[v % workers].push_back({v, u, distances[u] + weight});
+                        }
+                    });
+                };
+                auto apply = [&]() {
+                    for (int sender = 0; sender < workers; ++sender) {
+                        std::vector<Request>& inbox = state[sender].outbox[self];
+                        for (const Request& request : inbox) {
+                            if (request.distance < distances[request.target]) {
+                                distances[request.target] = request.distance;
+                                parents[request.target] = request.from;
+                                long long bucket = request.distance / delta;
+                                if (queuedIn[request.target] != bucket) {
+                                    queuedIn[request.target] = bucket;
+                                    mine.buckets[bucket % ringSize].push_back(request.target);
+                                }
+                            }
+                        }
+                        inbox.clear();
+                    }
+                };
+
+                long long current = 0;
+                while (true) {
+                    // Agree on the smallest non-empty bucket
+                    mine.nextBucket = LLONG_MAX;
+                    for (size_t step = 0; step < ringSize; ++step) {
+                        if (!mine.buckets[(current + step) % ringSize].empty()) {
+                            mine.nextBucket = current + step;
+                            break;
+                        }
+                    }
+                    barrier.wait();
+                    long long next = LLONG_MAX;
+                    for (const Worker& worker : state) {
+                        next = std::min(next, worker.nextBucket);
+                    }
+                    barrier.wait();
+                    if (next == LLONG_MAX) break;
+                    current = next;
+                    std::vector<int>& bucket = mine.buckets[current % ringSize];
+
+                    // Light edges may refill the current bucket, so repeat until it stays empty
+                    while (true) {
+                        mine.frontier.swap(bucket);
+                        bucket.clear();
+                        for (int u : mine.frontier) {
+                            if (queuedIn[u] != current) continue; // moved to an earlier bucket
+                            queuedIn[u] = -1;
+                            mine.settled.push_back(u);
+                            relax(u, true);
+                        }
+                        mine.frontier.clear();
+                        barrier.wait();
+                        apply();
+                        mine.active = !bucket.empty();
+                        barrier.wait();
+                        bool any = false;
+                        for (const Worker& worker : state) {
+                            any = any || worker.active;
+                        }
+                        barrier.wait();
+                        if (!any) break;
+                    }
+
+                    // Heavy edges only reach later buckets; relax them once per settled vertex
+                    std::sort(mine.settled.begin(), mine.settled.end());
+                    mine.settled.erase(std::unique(mine.settled.begin(), mine.settled.end()), mine.settled.end());
+                    for (int u : mine.settled) {
+                        relax(u, false);
+                    }
+                    mine.settled.clear();
+                    barrier.wait();
+                    apply();
+                }
+            });
+        }
+
+        // Kahn's algorithm; in-degrees are counted in parallel. Returns whether every
+        // vertex was ordered; on a cycle, order holds the vertices not behind one.
+        template <typename Adjacency>
+        bool kahnImpl(const Adjacency& adj, unsigned threads, std::vector<int>& order) {
+            int numVertices = adj.getNumVertices();
+            std::vector<std::atomic<int>> counted(numVertices);
+            for (std::atomic<int>& count : counted) {
+                count.store(0, std::memory_order_relaxed);
+            }
+            parallelFor(0, numVertices, threads, [&](unsigned, int begin, int end) {
+                for (int u = begin; u < end; ++u) {
+                    adj.forEachNeighbor(u, [&](int v, int) { counted[v].fetch_add(1, std::memory_order_relaxed); });
+                }
+            });
+            std::vector<int> inDegree(numVertices);
+            order.clear();
+            for (int v = 0; v < numVertices; ++v) {
+                inDegree[v] = counted[v].load(std::memory_order_relaxed);
+                if (inDegree[v] == 0) order.push_back(v);
+            }
+            for (size_t head = 0; head < order.size(); ++head) {
+                adj.forEachNeighbor(order[head], [&](int v, int) {
+                    if (--inDegree[v] == 0) order.push_back(v);
+                });
+            }
+            return static_cast<int>(order.size()) == numVertices;
+        }
+
+        // Whether the graph is acyclic, with its topological order, cached per graph version
+        struct Topology {
+            bool acyclic = false;
+            std::vector<int> order;
+            std::vector<int> position; // index of each vertex in order, when acyclic
+        };
+
+        VersionedCache<Topology>& topologyCache() {
+            static VersionedCache<Topology> cache(8);
+            return cache;
+        }
+
+        std::shared_ptr<const Topology> topologyFor(const Graph& g, unsigned threads) {
+            std::shared_ptr<const Topology> cached = topologyCache().find(g.getVersion(), 0);
+            if (!cached) {
+                std::shared_ptr<Topology> computed = std::make_shared<Topology>();
+                computed->acyclic = withAdjacency(g, [&](const auto& out, const auto*) { return kahnImpl(out, threads, computed->order); });
+                if (computed->acyclic) {
+                    computed->position.resize(computed->order.size());
+                    for (size_t i = 0; i < computed->order.size(); ++i) {
+                        computed->position[computed->order[i]] = i;
+                    }
+                }
+                topologyCache().insert(g.getVersion(), 0, computed);
+                cached = computed;
+            }
+            return cached;
+        }
+
+        // Relaxes out-edges once, in topological order from start, which is exact for
+        // any weights. Vertices before start in the order are unreachable from it, and
+        // the pass can stop at end because all of its in-edges have been relaxed.
+        // Longest (critical-path) distances are filled in the same pass when asked for.
+        template <typename Adjacency>
+        void dagRelax(const Adjacency& adj, const Topology& topology, int start, int end,
+                      std::vector<long long>& distances, std::vector<int>& parents,
+                      std::vector<long long>* longest = nullptr, std::vector<int>* longestParents = nullptr) {
+            int numVertices = adj.getNumVertices();
+            distances.assign(numVertices, LLONG_MAX);
+            parents.assign(numVertices, -1);
+            distances[start] = 0;
+            if (longest != nullptr) {
+                longest->assign(numVertices, LLONG_MIN);
+                longestParents->assign(numVertices, -1);
+                (*longest)[start] = 0;
+            }
+            for (int i = topology.position[start]; i < numVertices; ++i) {
+                int u = topology.order[i];
+                if (u == end) break;
+                if (distances[u] == LLONG_MAX) continue;
+                adj.forEachNeighbor(u, [&](int v, int weight) {
+                    if (distances[u] + weight < distances[v]) {
+                        distances[v] = distances[u] + weight;
+                        parents[v] = u;
+                    }
+                    if (longest != nullptr && (*longest)[u] + weight > (*longest)[v]) {
+                        (*longest)[v] = (*longest)[u] + weight;
+                        (*longestParents)[v] = u;
+                    }
+                });
+            }
+        }
+
+        void checkVertices(int numVertices, int start, int end) {
+            if (start < 0 || start >= numVertices || end < 0 || end >= numVertices) {
+                throw std::out_of_range("Vertex index out of range.");
+            }
+        }
+
+        // Single-source distances and parents from start, stopping early once end is
+        // settled when possible (end == -1 computes everything). Dijkstra when no
+        // weight is negative (O(V^2) scan on dense graphs, binary heap over the CSR
+        // view on sparse ones). With negative weights, Dijkstra over edges reweighted
+        // by the graph's cached Johnson potentials, or queue-based Bellman-Ford from
+        // start when the graph has a negative cycle somewhere. Acyclic graphs, whatever
+        // their weights, take a single pass in the cached topological order.
+        // Returns false if a negative cycle is reachable from start.
+        bool singleSource(const Graph& g, int start, int end, std::vector<long long>& distances, std::vector<int>& parents) {
+            int numVertices = g.getNumVertices();
+            std::shared_ptr<const Topology> topology = topologyFor(g, 1);
+            if (topology->acyclic) {
+                withAdjacency(g, [&](const auto& out, const auto*) { dagRelax(out, *topology, start, end, distances, parents); });
+                return true;
+            }
+            if (g.hasNegativeWeights()) {
+                std::shared_ptr<const Potentials> potentials = potentialsFor(g);
+                if (potentials->negativeCycle) {
+                    return !spfa(CsrAdjacency(g), start, distances, parents, pathScratch.cycle);
+                }
+                reweightedDijkstra(g, potentials->values, start, end, distances, parents);
+                return true;
+            }
+            const AdjacencyList& list = g.getAdjacencyList();
+            if (static_cast<long long>(list.targets.size()) * 8 < static_cast<long long>(numVertices) * numVertices) {
+                dijkstraHeap(CsrAdjacency(g), start, end, distances, parents);
+            } else {
+                dijkstraDense(g, start, end, distances, parents);
+            }
+            return true;
+        }
+
+        bool singleSource(const CompressedGraph& g, int start, int end, std::vector<long long>& distances, std::vector<int>& parents) {
+            if (g.hasNegativeWeights()) {
+                return !spfa(g, start, distances, parents, pathScratch.cycle);
+            }
+            dijkstraHeap(g, start, end, distances, parents);
+            return true;
+        }
+
+        template <typename AnyGraph>
+        void shortestPathImpl(const AnyGraph& g, int start, int end, PathResult& result) {
+            checkVertices(g.getNumVertices(), start, end);
+            if (!singleSource(g, start, end, pathScratch.distances, pathScratch.parents)) {
+                result.status = PathStatus::NegativeCycle;
+                result.path.clear();
+                return;
+            }
+            tracePath(pathScratch.distances, pathScratch.parents, start, end, result);
+        }
+
+        // One direction of a point-to-point search. The arrays stay sized to the graph
+        // and only the entries touched by the previous query are reset, so a short
+        // query costs O(explored) rather than O(V).
+        struct SearchSide {
+            std::vector<long long> distances;
+            std::vector<int> parents;
+            std::vector<int> touched;
+            std::vector<std::pair<long long, int>> heap; // (key, vertex), min-heap
+
+            void reset(int numVertices) {
+                if (static_cast<int>(distances.size()) != numVertices) {
+                    distances.assign(numVertices, LLONG_MAX);
+                    parents.assign(numVertices, -1);
+                } else {
+                    for (int v : touched) {
+                        distances[v] = LLONG_MAX;
+                        parents[v] = -1;
+                    }
+                }
+                touched.clear();
+                heap.clear();
+            }
+
+            void push(int v, long long distance, long long key, int parent) {
+                if (distances[v] == LLONG_MAX) touched.push_back(v);
+                distances[v] = distance;
+                parents[v] = parent;
+                heap.push_back({key, v});
+                std::push_heap(heap.begin(), heap.end(), std::greater<std::pair<long long, int>>());
+            }
+
+            std::pair<long long, int> pop() {
+                std::pop_heap(heap.begin(), heap.end(), std::greater<std::pair<long long, int>>());
+                std::pair<long long, int> top = heap.back();
+                heap.pop_back();
+                return top;
+            }
+
+            long long minKey() const { return heap.empty() ? LLONG_MAX : heap.front().first; }
+        };
+        thread_local SearchSide forwardSide;
+        thread_local SearchSide backwardSide;
+
+        // Bidirectional Dijkstra: a forward search over out-edges and a backward one over
+        // in-edges, always expanding the smaller frontier. Every improved distance is
+        // checked against the other side to keep the best meeting vertex, and the search
+        // stops once the two smallest keys together cannot beat it. Negative weights are
+        // handled by reweighting with the cached Johnson potentials.
+        void bidirectionalImpl(const Graph& g, int start, int end, PathResult& result) {
+            int numVertices = g.getNumVertices();
+            checkVertices(numVertices, start, end);
+            std::shared_ptr<const Potentials> potentials;
+            if (g.hasNegativeWeights()) {
+                potentials = potentialsFor(g);
+                if (potentials->negativeCycle) {
+                    shortestPathImpl(g, start, end, result);
+                    return;
+                }
+            }
+            auto reduced = [&](int from, int to, int weight) -> long long {
+                return potentials ? weight + potentials->values[from] - potentials->values[to] : weight;
+            };
+            const AdjacencyList& out = g.getAdjacencyList();
+            const AdjacencyList& in = g.getReverseAdjacencyList();
+
+            SearchSide& forward = forwardSide;
+            SearchSide& backward = backwardSide;
+            forward.reset(numVertices);
+            backward.reset(numVertices);
+            forward.push(start, 0, 0, -1);
+            backward.push(end, 0, 0, -1);
+            long long best = start == end ? 0 : LLONG_MAX;
+            int meet = start == end ? start : -1;
+
+            while (!forward.heap.empty() && !backward.heap.empty()) {
+                if (best != LLONG_MAX && forward.minKey() + backward.minKey() >= best) break;
+                bool isForward = forward.heap.size() <= backward.heap.size();
+                SearchSide& side = isForward ? forward : backward;
+                SearchSide& other = isForward ? backward : forward;
+                const AdjacencyList& list = isForward ? out : in;
+                std::pair<long long, int> top = side.pop();
+                int u = top.second;
+                if (top.first != side.distances[u]) continue; // stale entry
+                for (int e = list.offsets[u]; e < list.offsets[u + 1]; ++e) {
+                    int v = list.targets[e];
+                    long long distance = top.first + (isForward ? reduced(u, v, list.weights[e]) : reduced(v, u, list.weights[e]));
+                    if (distance < side.distances[v]) {
+                        side.push(v, distance, distance, u);
+                        if (other.distances[v] != LLONG_MAX && distance + other.distances[v] < best) {
+                            best = distance + other.distances[v];
+                            meet = v;
+                        }
+                    }
+                }
+            }
+
+            result.path.clear();
+            if (meet == -1) {
+                result.status = PathStatus::NoPath;
+                return;
+            }
+            for (int at = meet; at != -1; at = forward.parents[at]) {
+                result.path.push_back(at);
+            }
+            std::reverse(result.path.begin(), result.path.end());
+            for (int at = backward.parents[meet]; at != -1; at = backward.parents[at]) {
+                result.path.push_back(at);
+            }
+            result.status = PathStatus::Found;
+            result.distance = potentials ? best - potentials->values[start] + potentials->values[end] : best;
+        }
+
+        // A* over the CSR view. Entries are keyed by distance + heuristic; vertices may be
+        // expanded again when a shorter distance shows up, so the first time end is
+        // popped its distance is optimal for any admissible heuristic, consistent or not.
+        void aStarImpl(const Graph& g, int start, int end, const std::function<long long(int)>& heuristic, PathResult& result) {
+            int numVertices = g.getNumVertices();
+            checkVertices(numVertices, start, end);
+            if (g.hasNegativeWeights()) {
+                throw std::invalid_argument("A* requires non-negative edge weights.");
+            }
+            const AdjacencyList& list = g.getAdjacencyList();
+            SearchSide& side = forwardSide;
+            side.reset(numVertices);
+            side.push(start, 0, heuristic(start), -1);
+            result.path.clear();
+            result.status = PathStatus::NoPath;
+
+            while (!side.heap.empty()) {
+                std::pair<long long, int> top = side.pop();
+                int u = top.second;
+                long long distance = side.distances[u];
+                if (top.first != distance + heuristic(u)) continue; // stale entry
+                if (u == end) {
+                    for (int at = end; at != -1; at = side.parents[at]) {
+                        result.path.push_back(at);
+                    }
+                    std::reverse(result.path.begin(), result.path.end());
+                    result.status = PathStatus::Found;
+                    result.distance = distance;
+                    return;
+                }
+                for (int e = list.offsets[u]; e < list.offsets[u + 1]; ++e) {
+                    int v = list.targets[e];
+                    if (distance + list.weights[e] < side.distances[v]) {
+                        side.push(v, distance + list.weights[e], distance + list.weights[e] + heuristic(v), u);
+                    }
+                }
+            }
+        }
+
+        std::string formatPathResult(const PathResult& result) {
+            switch (result.status) {
+                case PathStatus::NegativeCycle:
+                    return "Graph contains a negative weight cycle";
+                case PathStatus::NoPath:
+                    return "-1";
+                default:
+                    return Algorithms::formatPath(result.path);
+            }
+        }
+    }
+
+    std::string Algorithms::formatPath(const std::vector<int> &path, bool closeCycle) {
+        std::string out;
+        out.reserve(path.size() * 4 + 8);
+        for (size_t i = 0; i < path.size(); ++i) {
+            if (i > 0) out += "->";
+            appendInt(out, path[i]);
+        }
+        if (closeCycle && !path.empty()) {
+            out += "->";
+            appendInt(out, path[0]); // Complete the cycle by connecting back to the start
+        }
+        return out;
+    }
+
+    static std::shared_ptr<const PropertyResult> bipartition(const Graph &g) {
+        return memoized(g, Bipartite, [&](std::vector<int>& witness) {
+            return withAdjacency(g, [&](const auto& out, const auto* in) { return isBipartiteImpl(out, in, witness); });
+        }, formatBipartition);
+    }
+
+    bool Algorithms::isBipartite(const Graph &g, std::vector<int> &colors) {
+        std::shared_ptr<const PropertyResult> result = bipartition(g);
+        colors = result->witness;
+        return result->holds;
+    }
+
+    std::string Algorithms::isBipartite(const Graph &g) {
+        return bipartition(g)->text;
+    }
+
+    std::string Algorithms::isBipartite(const CompressedGraph &g) {
+        std::vector<int> colors;
+        bool bipartite = isBipartiteImpl(g, static_cast<const CsrAdjacency*>(nullptr), colors);
+        return formatBipartition(bipartite, colors);
+    }
+
+    void Algorithms::breadthFirstSearch(const Graph &g, int source, BfsTree &tree) {
+        checkVertices(g.getNumVertices(), source, source);
+        tree.source = source;
+        withAdjacency(g, [&](const auto& out, const auto* in) {
+            BreadthFirstSearch<std::decay_t<decltype(out)>, std::decay_t<decltype(*in)>>(out, in, tree.levels, tree.parents).run(source);
+        });
+    }
+
+    void Algorithms::breadthFirstSearch(const CompressedGraph &g, int source, BfsTree &tree) {
+        checkVertices(g.getNumVertices(), source, source);
+        tree.source = source;
+        BreadthFirstSearch<CompressedGraph, CsrAdjacency>(g, nullptr, tree.levels, tree.parents).run(source);
+    }
+
+    void Algorithms::parallelBipartition(const Graph &g, BipartiteResult &result, unsigned threads) {
+        bool directed = g.isDirectedGraph();
+        withAdjacency(g, [&](const auto& out, const auto* in) {
+            parallelBipartitionImpl(out, directed ? in : nullptr, threads, result);
+        });
+    }
+
+    bool Algorithms::topologicalOrder(const Graph &g, std::vector<int> &order, unsigned threads) {
+        std::shared_ptr<const Topology> topology = topologyFor(g, threads);
+        order = topology->order;
+        return topology->acyclic;
+    }
+
+    bool Algorithms::isAcyclic(const Graph &g) {
+        return topologyFor(g, 0)->acyclic;
+    }
+
+    bool Algorithms::dagPaths(const Graph &g, int source, DagPaths &paths) {
+        checkVertices(g.getNumVertices(), source, source);
+        std::shared_ptr<const Topology> topology = topologyFor(g, 0);
+        paths.source = source;
+        if (!topology->acyclic) {
+            return false;
+        }
+        withAdjacency(g, [&](const auto& out, const auto*) {
+            dagRelax(out, *topology, source, -1, paths.shortest, paths.shortestParents, &paths.longest, &paths.longestParents);
+        });
+        return true;
+    }
+
+    bool Algorithms::isConnected(const Graph& g) {
+        return memoized(g, Connected, [&](std::vector<int>&) {
+            return withAdjacency(g, [](const auto& out, const auto* in) { return isConnectedImpl(out, in); });
+        }, noText)->holds;
+    }
+
+    int Algorithms::findRoot(const Graph &g) {
+        return withAdjacency(g, [](const auto& out, const auto* in) { return findRootImpl(out, in); });
+    }
+
+    int Algorithms::stronglyConnectedComponents(const Graph &g, std::vector<int> &components) {
+        return withAdjacency(g, [&](const auto& out, const auto*) { return tarjanImpl(out, components); });
+    }
+
+    int Algorithms::weaklyConnectedComponents(const Graph &g, std::vector<int> &components) {
+        return withAdjacency(g, [&](const auto& out, const auto*) { return weakComponentsImpl(out, components); });
+    }
+
+    int Algorithms::parallelConnectedComponents(const Graph &g, std::vector<int> &components, std::vector<int> &sizes, unsigned threads) {
+        return withAdjacency(g, [&](const auto& out, const auto* in) { return afforestImpl(out, in, threads, components, sizes); });
+    }
+
+    int Algorithms::parallelConnectedComponents(const CompressedGraph &g, std::vector<int> &components, std::vector<int> &sizes, unsigned threads) {
+        return afforestImpl(g, static_cast<const CsrAdjacency*>(nullptr), threads, components, sizes);
+    }
+
+    bool Algorithms::isStronglyConnected(const Graph &g) {
+        std::vector<int> components;
+        return stronglyConnectedComponents(g, components) == 1;
+    }
+
+    bool Algorithms::isWeaklyConnected(const Graph &g) {
+        std::vector<int> components;
+        return weaklyConnectedComponents(g, components) == 1;
+    }
+
+    bool Algorithms::isConnected(const CompressedGraph& g) {
+        return isConnectedImpl(g, static_cast<const CsrAdjacency*>(nullptr));
+    }
+
+    void Algorithms::shortestPath(const Graph &g, int start, int end, PathResult &result) {
+        shortestPathImpl(g, start, end, result);
+    }
+
+    void Algorithms::shortestPath(const CompressedGraph &g, int start, int end, PathResult &result) {
+        shortestPathImpl(g, start, end, result);
+    }
+
+    void Algorithms::bidirectionalShortestPath(const Graph &g, int start, int end, PathResult &result) {
+        bidirectionalImpl(g, start, end, result);
+    }
+
+    void Algorithms::aStarShortestPath(const Graph &g, int start, int end, const std::function<long long(int)> &heuristic, PathResult &result) {
+        aStarImpl(g, start, end, heuristic, result);
+    }
+
+    void Algorithms::shortestPathTree(const Graph &g, int source, ShortestPathTree &tree) {
+        checkVertices(g.getNumVertices(), source, source);
+        tree.source = source;
+        tree.negativeCycle = !singleSource(g, source, -1, tree.distances, tree.parents);
+    }
+
+    // Bucket width defaults to the largest weight over the average out-degree, the
+    // usual choice for weights spread evenly up to that maximum
+    void Algorithms::deltaSteppingTree(const Graph &g, int source, ShortestPathTree &tree, long long delta, unsigned threads) {
+        int numVertices = g.getNumVertices();
+        checkVertices(numVertices, source, source);
+        if (g.hasNegativeWeights()) {
+            shortestPathTree(g, source, tree);
+            return;
+        }
+        const AdjacencyList& list = g.getAdjacencyList();
+        long long maxWeight = 1;
+        for (int weight : list.weights) {
+            maxWeight = std::max<long long>(maxWeight, weight);
+        }
+        if (delta <= 0) {
+            long long arcs = std::max<long long>(1, list.targets.size());
+            delta = std::max<long long>(1, maxWeight * numVertices / arcs);
+        }
+        tree.source = source;
+        tree.negativeCycle = false;
+        if (static_cast<long long>(list.targets.size()) * 8 < static_cast<long long>(numVertices) * numVertices) {
+            deltaStepping(CsrAdjacency(g), source, delta, maxWeight, threads, tree.distances, tree.parents);
+        } else {
+            deltaStepping(DenseAdjacency(g), source, delta, maxWeight, threads, tree.distances, tree.parents);
+        }
+    }
+
+    bool Algorithms::pathTo(const ShortestPathTree &tree, int target, std::vector<int> &path) {
+        path.clear();
+        if (target < 0 || target >= static_cast<int>(tree.distances.size())) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        if (tree.negativeCycle || tree.distances[target] == LLONG_MAX) {
+            return false;
+        }
+        for (int at = target; at != -1; at = tree.parents[at]) {
+            path.push_back(at);
+        }
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+
+    std::shared_ptr<const ShortestPathTree> Algorithms::cachedShortestPathTree(const Graph &g, int source) {
+        std::shared_ptr<const ShortestPathTree> tree = treeCache().find(g.getVersion(), source);
+        if (!tree) {
+            std::shared_ptr<ShortestPathTree> computed = std::make_shared<ShortestPathTree>();
+            shortestPathTree(g, source, *computed);
+            treeCache().insert(g.getVersion(), source, computed);
+            tree = computed;
+        }
+        return tree;
+    }
+
+    void Algorithms::setShortestPathCacheCapacity(size_t capacity) {
+        treeCache().setCapacity(capacity);
+    }
+
+    // One Bellman-Ford pass for the potentials (shared with single-source queries
+    // through the cache), then an independent Dijkstra per source on the threads.
+    void Algorithms::johnsonShortestPaths(const Graph &g, AllPairsResult &result, unsigned threads) {
+        int numVertices = g.getNumVertices();
+        result.numVertices = numVertices;
+        result.next.clear();
+        Potentials zero;
+        std::shared_ptr<const Potentials> cached;
+        const Potentials* potentials = &zero;
+        if (g.hasNegativeWeights()) {
+            cached = potentialsFor(g);
+            potentials = cached.get();
+        } else {
+            zero.values.assign(numVertices, 0);
+        }
+        result.negativeCycle = potentials->negativeCycle;
+        if (result.negativeCycle) {
+            result.distances.clear();
+            return;
+        }
+        result.distances.resize(static_cast<size_t>(numVertices) * numVertices);
+
+        parallelFor(0, numVertices, threads, [&](unsigned, int begin, int end) {
+            std::vector<long long> distances;
+            std::vector<int> parents;
+            for (int source = begin; source < end; ++source) {
+                reweightedDijkstra(g, potentials->values, source, -1, distances, parents);
+                std::copy(distances.begin(), distances.end(), result.distances.begin() + static_cast<size_t>(source) * numVertices);
+            }
+        });
+    }
+
+    std::string Algorithms::shortestPath(const Graph& g, int start, int end) {
+        PathResult result;
+        shortestPath(g, start, end, result);
+        return formatPathResult(result);
+    }
+
+    std::string Algorithms::shortestPath(const CompressedGraph& g, int start, int end) {
+        PathResult result;
+        shortestPath(g, start, end, result);
+        return formatPathResult(result);
+    }
+
+    static std::shared_ptr<const PropertyResult> anyCycle(const Graph &g) {
+        return memoized(g, HasCycle, [&](std::vector<int>& witness) {
+            bool directed = g.isDirectedGraph();
+            return withAdjacency(g, [&](const auto& out, const auto*) { return findCycleImpl(out, directed, witness); });
+        }, formatCycle);
+    }
+
+    bool Algorithms::isContainsCycle(const Graph &g, std::vector<int> &cycle) {
+        std::shared_ptr<const PropertyResult> result = anyCycle(g);
+        cycle = result->witness;
+        return result->holds;
+    }
+
+    std::string Algorithms::isContainsCycle(const Graph &g) {
+        return anyCycle(g)->text;
+    }
+
+    // Returns true and the cycle (in edge order) if a negative cycle is reachable from src;
+    // src == -1 searches the whole graph in one pass from a virtual super-source
+    static bool bellmanFord(const Graph& g, int src, std::vector<int>& cycle) {
+        std::vector<long long> dist;
+        std::vector<int> parent;
+        return spfa(CsrAdjacency(g), src, dist, parent, cycle);
+    }
+
+    static std::shared_ptr<const PropertyResult> anyNegativeCycle(const Graph &g) {
+        return memoized(g, HasNegativeCycle, [&](std::vector<int>& witness) {
+            return g.hasNegativeWeights() && bellmanFord(g, -1, witness);
+        }, formatCycle);
+    }
+
+    bool Algorithms::negativeCycle(const Graph &g, std::vector<int> &cycle) {
+        std::shared_ptr<const PropertyResult> result = anyNegativeCycle(g);
+        cycle = result->witness;
+        return result->holds;
+    }
+
+    void Algorithms::setPropertyCacheBudget(size_t bytes) {
+        propertyCache().setCapacity(bytes);
+    }
+
+    std::string Algorithms::negativeCycle(const Graph &g) {
+        return anyNegativeCycle(g)->text;
+    }
+
+    }
@@ -1,29 +1,193 @@
-#ifndef ALGORITHMS_HPP
-#define ALGORITHMS_HPP
-
-#include <vector>
-#include <sstream>
-#include "Graph.hpp"
-#include <string>
-#include <algorithm> // Add this line
-#include <queue>
-#include <iostream>
-#include <stack>
-namespace ariel
-{
-    class Algorithms
-    {
-    public:
-        static bool isConnected(const Graph &g);
-        static std::string shortestPath(const Graph &g, int start, int end);
-        static std::string isContainsCycle(const Graph &g);
-        static  std::string negativeCycle(const Graph &g); // Added method declaration
-                static std::string isBipartite(const Graph &g); // Added method declaration
-
-
-    private:
-        static bool hasCycleHelper(const Graph& g, int v, std::vector<bool>& visited, int parent, std::vector<int>& cycle);
-    };
-}
-
-#endif
+#ifndef ALGORITHMS_HPP
+#define ALGORITHMS_HPP
+
+#include <vector>
+#include <sstream>
+#include "Graph.hpp"
+#include "CompressedGraph.hpp"
+#include <string>
+#include <algorithm> // Add this line
+#include <queue>
+#include <iostream>
+#include <stack>
+#include <memory>
+#include <functional>
+namespace ariel
+{
+    // Outcome of a typed shortest-path query
+    enum class PathStatus { Found, NoPath, NegativeCycle };
+
+    struct PathResult {
+        PathStatus status = PathStatus::NoPath;
+        long long distance = 0;     // valid when status == Found
+        std::vector<int> path;      // start, ..., end when status == Found
+    };
+
+    // Distances and parents from one source, for answering many targets
+    struct ShortestPathTree {
+        int source = -1;
+        bool negativeCycle = false;       // a negative cycle is reachable; the arrays are not meaningful
+        std::vector<long long> distances; // LLONG_MAX for unreachable vertices
+        std::vector<int> parents;         // -1 for the source and unreachable vertices
+    };
+
+    // Breadth-first levels and parents from one source; -1 for unreached vertices
+    struct BfsTree {
+        int source = -1;
+        std::vector<int> levels;
+        std::vector<int> parents;
+    };
+
+    // Two-colouring of the underlying undirected graph, or an odd cycle showing there is none
+    struct BipartiteResult {
+        bool bipartite = false;
+        std::vector<int> colors;                          // 0 or 1 per vertex; valid when bipartite
+        std::pair<int, int> conflictEdge = {-1, -1};      // an edge whose ends got the same colour
+        std::vector<int> oddCycle;                        // odd cycle through conflictEdge, in edge order
+    };
+
+    // Shortest and longest (critical-path) distances from one source in a DAG
+    struct DagPaths {
+        int source = -1;
+        std::vector<long long> shortest;  // LLONG_MAX for unreachable vertices
+        std::vector<int> shortestParents;
+        std::vector<long long> longest;   // LLONG_MIN for unreachable vertices
+        std::vector<int> longestParents;
+    };
+
+    // Minimum spanning forest of an undirected graph: one tree per component,
+    // edges listed with from < to in increasing (from, to) order
+    struct SpanningEdge {
+        int from;
+        int to;
+        int weight;
+    };
+
+    struct SpanningForest {
+        long long totalWeight = 0;
+        int trees = 0;
+        std::vector<SpanningEdge> edges;
+    };
+
+    // Maximum flow from source to sink with matrix entries as capacities, and the
+    // minimum cut it certifies
+    struct FlowResult {
+        int numVertices = 0;
+        long long value = 0;
+        std::vector<long long> flows;  // flows[from * numVertices + to], never negative
+        std::vector<bool> sourceSide;  // minimum cut: vertices that cannot reach the sink in the residual graph
+
+        long long flow(int from, int to) const { return flows[static_cast<size_t>(from) * numVertices + to]; }
+    };
+
+    // Distances between every pair of vertices, row-major
+    struct AllPairsResult {
+        int numVertices = 0;
+        bool negativeCycle = false;       // the graph has a negative cycle; the matrices are left empty
+        std::vector<long long> distances; // distances[from * numVertices + to], LLONG_MAX when unreachable
+        std::vector<int> next;            // first hop from `from` towards `to`, -1 when unreachable; only when requested
+
+        long long distance(int from, int to) const { return distances[static_cast<size_t>(from) * numVertices + to]; }
+    };
+
+    class Algorithms
+    {
+    public:
+        static bool isConnected(const Graph &g);
+        static std::string shortestPath(const Graph &g, int start, int end);
+        static std::string isContainsCycle(const Graph &g);
+        static  std::string negativeCycle(const Graph &g); // Added method declaration
+                static std::string isBipartite(const Graph &g); // Added method declaration
+
+        // Kahn's algorithm with parallel in-degree counting. Returns false when the graph
+        // has a cycle, leaving in order the vertices that are not behind one. The
+        // result is cached per graph version, and shortestPath uses it to relax
+        // acyclic graphs in one linear pass whatever their weights.
+        static bool topologicalOrder(const Graph &g, std::vector<int> &order, unsigned threads = 0);
+        static bool isAcyclic(const Graph &g);
+        static bool dagPaths(const Graph &g, int source, DagPaths &paths); // false when not a DAG
+
+        // Direction-optimizing BFS: switches between top-down and bottom-up steps
+        static void breadthFirstSearch(const Graph &g, int source, BfsTree &tree);
+        static void breadthFirstSearch(const CompressedGraph &g, int source, BfsTree &tree);
+
+        // Linear-time connectivity: O(V^2) on the matrix, O(V + E) over the CSR view of
+        // sparse graphs. isConnected asks for a vertex with outgoing edges that reaches
+        // every vertex. Component ids run from 0 to the returned count - 1; strong
+        // components are numbered in reverse topological order (sinks first).
+        static int findRoot(const Graph &g); // a vertex reaching every vertex, or -1
+        static int stronglyConnectedComponents(const Graph &g, std::vector<int> &components);
+        static int weaklyConnectedComponents(const Graph &g, std::vector<int> &components);
+        // Weak components with parallel Afforest union-find; sizes[id] counts the
+        // vertices of each component (threads = 0 uses every hardware thread)
+        static int parallelConnectedComponents(const Graph &g, std::vector<int> &components, std::vector<int> &sizes, unsigned threads = 0);
+        static int parallelConnectedComponents(const CompressedGraph &g, std::vector<int> &components, std::vector<int> &sizes, unsigned threads = 0);
+        static bool isStronglyConnected(const Graph &g);
+        static bool isWeaklyConnected(const Graph &g);
+
+        // Traversals over the read-only compressed representation
+        static bool isConnected(const CompressedGraph &g);
+        static std::string shortestPath(const CompressedGraph &g, int start, int end);
+        static std::string isBipartite(const CompressedGraph &g);
+
+        // Typed results behind the string APIs above. Output containers are reused,
+        // so repeated calls with the same containers do not allocate.
+        static void shortestPath(const Graph &g, int start, int end, PathResult &result);
+        static void shortestPath(const CompressedGraph &g, int start, int end, PathResult &result);
+        static bool isBipartite(const Graph &g, std::vector<int> &colors); // colors[v]: 0 = set A, 1 = set B
+        static bool isContainsCycle(const Graph &g, std::vector<int> &cycle);
+        // Parallel bipartiteness over edges of either direction (threads = 0 uses every
+        // hardware thread); reports a conflict edge and odd cycle when it fails
+        static void parallelBipartition(const Graph &g, BipartiteResult &result, unsigned threads = 0);
+        static bool negativeCycle(const Graph &g, std::vector<int> &cycle); // cycle in edge order
+
+        // Point-to-point searches that stop long before the whole graph is explored.
+        // The heuristic estimates the remaining distance to end and must never
+        // overestimate it (e.g. straight-line distance on spatial graphs).
+        static void bidirectionalShortestPath(const Graph &g, int start, int end, PathResult &result);
+        static void aStarShortestPath(const Graph &g, int start, int end, const std::function<long long(int)> &heuristic, PathResult &result);
+
+        // Single-source trees: computed once per source, then any target is
+        // reconstructed by pathTo in O(path length)
+        static void shortestPathTree(const Graph &g, int source, ShortestPathTree &tree);
+        static bool pathTo(const ShortestPathTree &tree, int target, std::vector<int> &path);
+        // Same tree from parallel delta-stepping with buckets of width delta (0 picks one
+        // from the weights); graphs with negative weights use the sequential path
+        static void deltaSteppingTree(const Graph &g, int source, ShortestPathTree &tree, long long delta = 0, unsigned threads = 0);
+        // Same tree through an LRU cache keyed by (graph version, source); modifying the
+        // graph changes its version, so stale trees are never returned
+        static std::shared_ptr<const ShortestPathTree> cachedShortestPathTree(const Graph &g, int source);
+        static void setShortestPathCacheCapacity(size_t capacity); // 0 disables the cache
+
+        // isConnected, isBipartite, isContainsCycle and negativeCycle on a Graph are
+        // memoized with their witnesses per graph version, so repeated calls on an
+        // unchanged graph skip the traversal. The cache is shared by all threads and
+        // keeps its entries within a byte budget (4 MB by default, 0 disables it).
+        static void setPropertyCacheBudget(size_t bytes);
+
+        // Blocked Floyd-Warshall; off-diagonal tiles are updated in parallel
+        // (threads = 0 uses every hardware thread)
+        static void allPairsShortestPaths(const Graph &g, AllPairsResult &result, bool withNextHops = false, unsigned threads = 0);
+        static bool pathBetween(const AllPairsResult &result, int from, int to, std::vector<int> &path);
+        // Johnson's algorithm for sparse graphs: Bellman-Ford potentials, then parallel
+        // per-source Dijkstra on reweighted edges. result.distances is reused when it
+        // already has room; no next hops are produced.
+        static void johnsonShortestPaths(const Graph &g, AllPairsResult &result, unsigned threads = 0);
+
+        // Minimum spanning forest of an undirected graph (throws std::invalid_argument
+        // on a directed one). The general entry point runs Prim on dense graphs and
+        // Boruvka on sparse ones; both can be called directly.
+        static void minimumSpanningForest(const Graph &g, SpanningForest &forest, unsigned threads = 0);
+        static void primSpanningForest(const Graph &g, SpanningForest &forest);
+        static void boruvkaSpanningForest(const Graph &g, SpanningForest &forest, unsigned threads = 0);
+
+        // Highest-label push-relabel on a dense residual matrix, with global relabelling
+        // and the gap heuristic. Capacities must be non-negative.
+        static void maximumFlow(const Graph &g, int source, int sink, FlowResult &result);
+
+        // "a->b->...->z", optionally closed back to the first vertex
+        static std::string formatPath(const std::vector<int> &path, bool closeCycle = false);
+    };
+}
+
+#endif
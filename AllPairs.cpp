@@ -0,0 +1,178 @@
+#include "Algorithms.hpp"
+#include "Parallel.hpp"
+#include <climits>
+#include <stdexcept>
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace ariel {
+    namespace {
+        const int TileSize = 64;                      // 64 x 64 distances = 32 KB per tile
+        const long long Unreachable = LLONG_MAX / 4;  // two of them still add without overflow
+
+        // c[j] = min(c[j], a + b[j]) over one tile row
+        inline void relaxRow(long long* c, const long long* b, long long a) {
+#if defined(__AVX2__)
+            const __m256i av = _mm256_set1_epi64x(a);
+            for (int j = 0; j < TileSize; j += 4) {
+                __m256i cv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + j));
+                __m256i sum = _mm256_add_epi64(av, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j)));
+                cv = _mm256_blendv_epi8(cv, sum, _mm256_cmpgt_epi64(cv, sum));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(c + j), cv);
+            }
+#elif defined(__SSE4_2__)
+            const __m128i av = _mm_set1_epi64x(a);
+            for (int j = 0; j < TileSize; j += 2) {
+                __m128i cv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + j));
+                __m128i sum = _mm_add_epi64(av, _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j)));
+                cv = _mm_blendv_epi8(cv, sum, _mm_cmpgt_epi64(cv, sum));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(c + j), cv);
+            }
+#else
+            for (int j = 0; j < TileSize; ++j) {
+                long long sum = a + b[j];
+                c[j] = sum < c[j] ? sum : c[j];
+            }
+#endif
+        }
+
+        // Same relaxation, also copying the first hop of every improved entry
+        inline void relaxRow(long long* c, int* cNext, const long long* b, long long a, int hop) {
+            for (int j = 0; j < TileSize; ++j) {
+                long long sum = a + b[j];
+                if (sum < c[j]) {
+                    c[j] = sum;
+                    cNext[j] = hop;
+                }
+            }
+        }
+
+        // Padded row-major matrices for the blocked algorithm
+        struct TiledMatrix {
+            int tiles;
+            size_t stride;
+            std::vector<long long> dist;
+            std::vector<int> next;
+
+            long long* tile(int ti, int tj) { return dist.data() + static_cast<size_t>(ti) * TileSize * stride + static_cast<size_t>(tj) * TileSize; }
+            int* nextTile(int ti, int tj) { return next.data() + static_cast<size_t>(ti) * TileSize * stride + static_cast<size_t>(tj) * TileSize; }
+
+            // Tile (ti, tj) = min(tile(ti, tj), tile(ti, tk) (+) tile(tk, tj)) in the min-plus sense.
+            // k is the outer loop, so the target may be the same tile as either source,
+            // as happens for the diagonal and the row and column of the current round.
+            void relax(int ti, int tj, int tk) {
+                long long* c = tile(ti, tj);
+                const long long* a = tile(ti, tk);
+                const long long* b = tile(tk, tj);
+                for (int k = 0; k < TileSize; ++k) {
+                    const long long* bRow = b + k * stride;
+                    for (int i = 0; i < TileSize; ++i) {
+                        long long aik = a[i * stride + k];
+                        if (aik >= Unreachable / 2) continue;
+                        if (next.empty()) {
+                            relaxRow(c + i * stride, bRow, aik);
+                        } else {
+                            relaxRow(c + i * stride, nextTile(ti, tj) + i * stride, bRow, aik, nextTile(ti, tk)[i * stride + k]);
+                        }
+                    }
+                }
+            }
+        };
+    }
+
+    // Three phases per round k: the diagonal tile (k, k) is closed on its own, then the
+    // tiles of row k and column k are relaxed through it, then every remaining tile
+    // (i, j) takes min-plus products of (i, k) and (k, j). Tiles within phases two and
+    // three are independent, so they are split across threads. Negative cycles are
+    // found first with the super-source search behind negativeCycle, which also keeps
+    // distances bounded during the main loop.
+    void Algorithms::allPairsShortestPaths(const Graph &g, AllPairsResult &result, bool withNextHops, unsigned threads) {
+        int n = g.getNumVertices();
+        result.numVertices = n;
+        result.distances.clear();
+        result.next.clear();
+        std::vector<int> cycle;
+        result.negativeCycle = negativeCycle(g, cycle);
+        if (result.negativeCycle || n == 0) {
+            return;
+        }
+
+        TiledMatrix m;
+        m.tiles = (n + TileSize - 1) / TileSize;
+        m.stride = static_cast<size_t>(m.tiles) * TileSize;
+        m.dist.assign(m.stride * m.stride, Unreachable);
+        if (withNextHops) {
+            m.next.assign(m.stride * m.stride, -1);
+        }
+        const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (adjacencyMatrix[i][j] != 0 && i != j) {
+                    m.dist[i * m.stride + j] = adjacencyMatrix[i][j];
+                    if (withNextHops) m.next[i * m.stride + j] = j;
+                }
+            }
+        }
+        for (size_t i = 0; i < m.stride; ++i) {
+            m.dist[i * m.stride + i] = 0;
+            if (withNextHops) m.next[i * m.stride + i] = static_cast<int>(i);
+        }
+
+        int others = m.tiles - 1;
+        for (int k = 0; k < m.tiles; ++k) {
+            m.relax(k, k, k);
+            parallelFor(0, 2 * others, threads, [&](unsigned, int begin, int end) {
+                for (int t = begin; t < end; ++t) {
+                    int other = t % others;
+                    other += other >= k;
+                    if (t < others) {
+                        m.relax(k, other, k);
+                    } else {
+                        m.relax(other, k, k);
+                    }
+                }
+            });
+            parallelFor(0, others * others, threads, [&](unsigned, int begin, int end) {
+                for (int t = begin; t < end; ++t) {
+                    int i = t / others;
+                    int j = t % others;
+                    i += i >= k;
+                    j += j >= k;
+                    m.relax(i, j, k);
+                }
+            });
+        }
+
+        result.distances.resize(static_cast<size_t>(n) * n);
+        if (withNextHops) {
+            result.next.resize(static_cast<size_t>(n) * n);
+        }
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                long long d = m.dist[i * m.stride + j];
+                result.distances[static_cast<size_t>(i) * n + j] = d >= Unreachable / 2 ? LLONG_MAX : d;
+                if (withNextHops) result.next[static_cast<size_t>(i) * n + j] = d >= Unreachable / 2 ? -1 : m.next[i * m.stride + j];
+            }
+        }
+    }
+
+    bool Algorithms::pathBetween(const AllPairsResult &result, int from, int to, std::vector<int> &path) {
+        path.clear();
+        if (from < 0 || from >= result.numVertices || to < 0 || to >= result.numVertices) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        if (result.negativeCycle || result.distance(from, to) == LLONG_MAX) {
+            return false;
+        }
+        if (result.next.empty()) {
+            throw std::invalid_argument("Next hops were not computed for this result.");
+        }
+        path.push_back(from);
+        for (int at = from; at != to;) {
+            at = result.next[static_cast<size_t>(at) * result.numVertices + to];
+            path.push_back(at);
+        }
+        return true;
+    }
+}
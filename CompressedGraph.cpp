@@ -0,0 +1,157 @@
+#include "CompressedGraph.hpp"
+
+namespace ariel {
+    CompressedGraph::CompressedGraph() : numVertices(0), numArcs(0), negativeWeights(false), offsets(1, 0) {}
+
+    CompressedGraph::CompressedGraph(const Graph& g) : CompressedGraph() {
+        const std::vector<std::vector<int>>& adjacencyMatrix = g.getAdjacencyMatrix();
+        numVertices = g.getNumVertices();
+        offsets.reserve(numVertices + 1);
+
+        std::vector<int> rowTargets;
+        std::vector<int> rowWeights;
+        for (int u = 0; u < numVertices; ++u) {
+            rowTargets.clear();
+            rowWeights.clear();
+            for (int v = 0; v < numVertices; ++v) {
+                if (adjacencyMatrix[u][v] != 0) {
+                    rowTargets.push_back(v);
+                    rowWeights.push_back(adjacencyMatrix[u][v]);
+                }
+            }
+            appendRow(u, rowTargets, rowWeights);
+        }
+        scratch.clear();
+        scratch.shrink_to_fit();
+        bytes.shrink_to_fit();
+    }
+
+    int CompressedGraph::getNumVertices() const {
+        return numVertices;
+    }
+
+    long long CompressedGraph::getNumArcs() const {
+        return numArcs;
+    }
+
+    int CompressedGraph::getDegree(int v) const {
+        const unsigned char* p = bytes.data() + offsets[v];
+        return static_cast<int>(readVarint(p) >> 1);
+    }
+
+    bool CompressedGraph::hasNegativeWeights() const {
+        return negativeWeights;
+    }
+
+    size_t CompressedGraph::getSizeInBytes() const {
+        return bytes.size() + offsets.size() * sizeof(size_t);
+    }
+
+    void CompressedGraph::writeVarint(std::vector<unsigned char>& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<unsigned char>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<unsigned char>(value));
+    }
+
+    // Encodes one row; rowTargets must be strictly increasing
+    void CompressedGraph::appendRow(int from, const std::vector<int>& rowTargets, const std::vector<int>& rowWeights) {
+        size_t degree = rowTargets.size();
+        bool weighted = false;
+        for (int w : rowWeights) {
+            if (w != 1) weighted = true;
+            if (w < 0) negativeWeights = true;
+        }
+
+        writeVarint(bytes, (static_cast<uint64_t>(degree) << 1) | (weighted ? 1 : 0));
+        if (degree > 0) {
+            // Split maximal runs of consecutive ids into intervals and residuals
+            scratch.clear();
+            std::vector<bool> inInterval(degree, false);
+            long long intervalCount = 0;
+            long long previousEnd = 0;
+            for (size_t i = 0; i < degree;) {
+                size_t j = i + 1;
+                while (j < degree && rowTargets[j] == rowTargets[j - 1] + 1) ++j;
+                if (j - i >= static_cast<size_t>(MinIntervalLength)) {
+                    long long start = rowTargets[i];
+                    writeVarint(scratch, intervalCount == 0 ? zigzag(start - from) : static_cast<uint64_t>(start - previousEnd - 2));
+                    writeVarint(scratch, j - i - MinIntervalLength);
+                    for (size_t k = i; k < j; ++k) {
+                        inInterval[k] = true;
+                        if (weighted) writeVarint(scratch, zigzag(rowWeights[k]));
+                    }
+                    previousEnd = rowTargets[j - 1];
+                    ++intervalCount;
+                }
+                i = j;
+            }
+
+            writeVarint(bytes, intervalCount);
+            if (intervalCount > 0) {
+                writeVarint(bytes, scratch.size());
+                bytes.insert(bytes.end(), scratch.begin(), scratch.end());
+            }
+
+            bool firstResidual = true;
+            long long previous = 0;
+            for (size_t k = 0; k < degree; ++k) {
+                if (inInterval[k]) continue;
+                long long target = rowTargets[k];
+                writeVarint(bytes, firstResidual ? zigzag(target - from) : static_cast<uint64_t>(target - previous - 1));
+                if (weighted) writeVarint(bytes, zigzag(rowWeights[k]));
+                firstResidual = false;
+                previous = target;
+            }
+        }
+
+        offsets.push_back(bytes.size());
+        numArcs += degree;
+    }
+
+    CompressedGraph::Builder::Builder(int numVertices) : currentRow(0) {
+        if (numVertices < 0) {
+            throw std::invalid_argument("Number of vertices must be non-negative.");
+        }
+        result.numVertices = numVertices;
+        result.offsets.reserve(numVertices + 1);
+    }
+
+    void CompressedGraph::Builder::addEdge(int from, int to, int weight) {
+        if (from < 0 || from >= result.numVertices || to < 0 || to >= result.numVertices) {
+            throw std::out_of_range("Edge endpoint is out of range.");
+        }
+        if (weight == 0) {
+            throw std::invalid_argument("Edge weight 0 means no edge.");
+        }
+        if (from < currentRow || (from == currentRow && !targets.empty() && to <= targets.back())) {
+            throw std::invalid_argument("Edges must be added in increasing (from, to) order.");
+        }
+        while (currentRow < from) {
+            flushRow();
+        }
+        targets.push_back(to);
+        weights.push_back(weight);
+    }
+
+    void CompressedGraph::Builder::flushRow() {
+        result.appendRow(currentRow, targets, weights);
+        targets.clear();
+        weights.clear();
+        ++currentRow;
+    }
+
+    CompressedGraph CompressedGraph::Builder::build() {
+        while (currentRow < result.numVertices) {
+            flushRow();
+        }
+        result.scratch.clear();
+        result.scratch.shrink_to_fit();
+        result.bytes.shrink_to_fit();
+        CompressedGraph built = std::move(result);
+        result = CompressedGraph();
+        currentRow = 0;
+        return built;
+    }
+}
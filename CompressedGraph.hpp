@@ -0,0 +1,151 @@
+#ifndef COMPRESSEDGRAPH_HPP
+#define COMPRESSEDGRAPH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include "Graph.hpp"
+
+namespace ariel {
+    // Read-only adjacency structure for graphs too large for a dense matrix.
+    // Each row is stored as gap-encoded varints; runs of at least
+    // MinIntervalLength consecutive neighbours are stored as (start, length)
+    // intervals in the WebGraph style. Rows whose weights are all 1 do not
+    // store weights at all.
+    //
+    // Row layout: varint(degree << 1 | weighted), and when degree > 0:
+    //   varint(intervalCount) [varint(intervalBytes)]
+    //   intervals: gap, length - MinIntervalLength, [weight per element]
+    //   residuals: gap, [weight]
+    // The first gap of each section is relative to the row's own vertex (zigzag),
+    // later ones to the previous element of the same section.
+    class CompressedGraph {
+    public:
+        static const int MinIntervalLength = 4;
+
+        class Builder;
+
+        CompressedGraph();
+        explicit CompressedGraph(const Graph& g);
+
+        int getNumVertices() const;
+        long long getNumArcs() const; // stored (directed) adjacency entries
+        int getDegree(int v) const;
+        bool hasNegativeWeights() const;
+        size_t getSizeInBytes() const;
+
+        // Calls visit(to, weight) for every out-neighbour of v in increasing order of id
+        template <typename Visitor>
+        void forEachNeighbor(int v, Visitor visit) const;
+
+    private:
+        void appendRow(int from, const std::vector<int>& rowTargets, const std::vector<int>& rowWeights);
+
+        static void writeVarint(std::vector<unsigned char>& out, uint64_t value);
+        static uint64_t readVarint(const unsigned char*& p) {
+            uint64_t value = 0;
+            int shift = 0;
+            while (*p & 0x80) {
+                value |= static_cast<uint64_t>(*p++ & 0x7f) << shift;
+                shift += 7;
+            }
+            return value | (static_cast<uint64_t>(*p++) << shift);
+        }
+        static uint64_t zigzag(long long value) {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+        static long long unzigzag(uint64_t value) {
+            return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+        }
+
+        int numVertices;
+        long long numArcs;
+        bool negativeWeights;
+        std::vector<unsigned char> bytes;
+        std::vector<size_t> offsets;          // row v occupies bytes[offsets[v], offsets[v + 1])
+        std::vector<unsigned char> scratch;   // interval section being encoded
+    };
+
+    // Streams edges in row-major order (by source, then by target) into a CompressedGraph.
+    class CompressedGraph::Builder {
+    public:
+        explicit Builder(int numVertices);
+        void addEdge(int from, int to, int weight = 1);
+        CompressedGraph build();
+
+    private:
+        void flushRow();
+
+        CompressedGraph result;
+        int currentRow;
+        std::vector<int> targets;
+        std::vector<int> weights;
+    };
+
+    template <typename Visitor>
+    void CompressedGraph::forEachNeighbor(int v, Visitor visit) const {
+        const unsigned char* p = bytes.data() + offsets[v];
+        uint64_t header = readVarint(p);
+        long long degree = static_cast<long long>(header >> 1);
+        bool weighted = header & 1;
+        if (degree == 0) return;
+
+        long long intervalsLeft = static_cast<long long>(readVarint(p));
+        const unsigned char* ip = p;
+        const unsigned char* rp = p;
+        if (intervalsLeft > 0) {
+            uint64_t intervalBytes = readVarint(p);
+            ip = p;
+            rp = p + intervalBytes;
+        }
+
+        // Interval cursor
+        long long runLeft = 0;
+        long long intervalValue = 0;
+        int intervalWeight = 1;
+        bool firstInterval = true;
+        auto nextInterval = [&]() -> bool {
+            if (runLeft == 0) {
+                if (intervalsLeft == 0) return false;
+                --intervalsLeft;
+                uint64_t gap = readVarint(ip);
+                long long start = firstInterval ? v + unzigzag(gap) : intervalValue + 2 + static_cast<long long>(gap);
+                firstInterval = false;
+                runLeft = static_cast<long long>(readVarint(ip)) + MinIntervalLength;
+                intervalValue = start - 1;
+            }
+            ++intervalValue;
+            --runLeft;
+            intervalWeight = weighted ? static_cast<int>(unzigzag(readVarint(ip))) : 1;
+            return true;
+        };
+
+        // Residual cursor
+        long long residualValue = 0;
+        int residualWeight = 1;
+        bool firstResidual = true;
+        bool hasInterval = nextInterval();
+        auto nextResidual = [&]() -> bool {
+            if (rp == bytes.data() + offsets[v + 1]) return false;
+            uint64_t gap = readVarint(rp);
+            residualValue = firstResidual ? v + unzigzag(gap) : residualValue + 1 + static_cast<long long>(gap);
+            firstResidual = false;
+            residualWeight = weighted ? static_cast<int>(unzigzag(readVarint(rp))) : 1;
+            return true;
+        };
+        bool hasResidual = nextResidual();
+
+        for (long long remaining = degree; remaining > 0; --remaining) {
+            if (hasInterval && (!hasResidual || intervalValue < residualValue)) {
+                visit(static_cast<int>(intervalValue), intervalWeight);
+                hasInterval = nextInterval();
+            } else {
+                visit(static_cast<int>(residualValue), residualWeight);
+                hasResidual = nextResidual();
+            }
+        }
+    }
+}
+
+#endif
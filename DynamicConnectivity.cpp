@@ -0,0 +1,101 @@
+#include "DynamicConnectivity.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace ariel {
+    DynamicConnectivity::DynamicConnectivity(Graph& g) : graph(g), version(0), stale(true), components(0) {
+        rebuild();
+    }
+
+    void DynamicConnectivity::addEdge(int from, int to, int weight) {
+        if (version != graph.getVersion()) stale = true;
+        graph.addEdge(from, to, weight);
+        version = graph.getVersion();
+        if (!stale && unite(from, to)) {
+            forest.insert(pairKey(from, to));
+        }
+    }
+
+    // The pair stays linked while the opposite entry is set; removing a pair that
+    // is not in the forest cannot split a component
+    bool DynamicConnectivity::removeEdge(int from, int to) {
+        if (version != graph.getVersion()) stale = true;
+        if (!graph.removeEdge(from, to)) {
+            return false;
+        }
+        version = graph.getVersion();
+        if (!stale && graph.getAdjacencyMatrix()[to][from] == 0 && forest.erase(pairKey(from, to)) > 0) {
+            stale = true;
+        }
+        return true;
+    }
+
+    bool DynamicConnectivity::connected(int u, int v) {
+        refresh();
+        if (u < 0 || u >= graph.getNumVertices() || v < 0 || v >= graph.getNumVertices()) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        return find(u) == find(v);
+    }
+
+    bool DynamicConnectivity::isConnected() {
+        refresh();
+        return components <= 1;
+    }
+
+    int DynamicConnectivity::getNumComponents() {
+        refresh();
+        return components;
+    }
+
+    int DynamicConnectivity::componentOf(int v) {
+        refresh();
+        if (v < 0 || v >= graph.getNumVertices()) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        return find(v);
+    }
+
+    void DynamicConnectivity::refresh() {
+        if (stale || version != graph.getVersion()) {
+            rebuild();
+        }
+    }
+
+    void DynamicConnectivity::rebuild() {
+        int numVertices = graph.getNumVertices();
+        parent.resize(numVertices);
+        for (int v = 0; v < numVertices; ++v) parent[v] = v;
+        components = numVertices;
+        forest.clear();
+        const AdjacencyList& list = graph.getAdjacencyList();
+        for (int u = 0; u < numVertices; ++u) {
+            for (int k = list.offsets[u]; k < list.offsets[u + 1]; ++k) {
+                if (unite(u, list.targets[k])) forest.insert(pairKey(u, list.targets[k]));
+            }
+        }
+        version = graph.getVersion();
+        stale = false;
+    }
+
+    int DynamicConnectivity::find(int v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    }
+
+    bool DynamicConnectivity::unite(int u, int v) {
+        int a = find(u);
+        int b = find(v);
+        if (a == b) return false;
+        parent[std::max(a, b)] = std::min(a, b);
+        --components;
+        return true;
+    }
+
+    long long DynamicConnectivity::pairKey(int u, int v) const {
+        return static_cast<long long>(std::min(u, v)) * graph.getNumVertices() + std::max(u, v);
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef DYNAMICCONNECTIVITY_HPP
+#define DYNAMICCONNECTIVITY_HPP
+
+#include <vector>
+#include <unordered_set>
+#include "Graph.hpp"
+
+namespace ariel {
+    // Connected components of a graph under edge insertions and deletions, with
+    // edge directions ignored. Edits made through addEdge/removeEdge update both
+    // the graph and the components: an insertion is one union-find link, and a
+    // deletion only matters when it removes an edge of the spanning forest, in
+    // which case the components are rebuilt lazily on the next query. Edits made
+    // directly on the graph are noticed through its version and also trigger a
+    // rebuild. Queries compress union-find paths, so instances are not safe for
+    // concurrent use.
+    class DynamicConnectivity {
+    public:
+        explicit DynamicConnectivity(Graph& g);
+
+        void addEdge(int from, int to, int weight = 1);
+        bool removeEdge(int from, int to); // false when there was no edge
+
+        bool connected(int u, int v); // same component
+        bool isConnected();           // a single component
+        int getNumComponents();
+        int componentOf(int v);       // the smallest vertex of v's component
+
+    private:
+        void refresh();
+        void rebuild();
+        int find(int v);
+        bool unite(int u, int v);
+        long long pairKey(int u, int v) const;
+
+        Graph& graph;
+        unsigned long long version; // graph version the components describe
+        bool stale;                 // a forest edge was removed since the last rebuild
+        int components;
+        std::vector<int> parent;     // roots are the smallest vertex of their component
+        std::unordered_set<long long> forest; // pairs whose insertion joined two components
+    };
+}
+
+#endif
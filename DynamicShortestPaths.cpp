@@ -0,0 +1,177 @@
+#include "DynamicShortestPaths.hpp"
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <stdexcept>
+
+namespace ariel {
+    DynamicShortestPaths::DynamicShortestPaths(Graph& g) : graph(g), version(0), negativeWeights(0) {
+        refresh();
+    }
+
+    void DynamicShortestPaths::addSource(int source) {
+        if (source < 0 || source >= graph.getNumVertices()) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        refresh();
+        Algorithms::shortestPathTree(graph, source, trees[source]);
+    }
+
+    void DynamicShortestPaths::removeSource(int source) {
+        trees.erase(source);
+    }
+
+    void DynamicShortestPaths::setWeight(int from, int to, int weight) {
+        int numVertices = graph.getNumVertices();
+        if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+            throw std::out_of_range("Edge endpoint is out of range.");
+        }
+        refresh();
+        int old = graph.getAdjacencyMatrix()[from][to];
+        if (weight == old) return;
+        if (weight == 0) {
+            graph.removeEdge(from, to);
+        } else {
+            graph.addEdge(from, to, weight);
+        }
+        version = graph.getVersion();
+        negativeWeights += (weight < 0) - (old < 0);
+
+        for (auto& entry : trees) {
+            ShortestPathTree& t = entry.second;
+            if (negativeWeights > 0 || old < 0 || t.negativeCycle) {
+                Algorithms::shortestPathTree(graph, t.source, t);
+            } else if (from == to) {
+                continue;
+            } else if (old == 0 || (weight != 0 && weight < old)) {
+                decrease(t, from, to, weight);
+            } else {
+                increase(t, from, to);
+            }
+        }
+    }
+
+    void DynamicShortestPaths::addEdge(int from, int to, int weight) {
+        if (weight == 0) {
+            throw std::invalid_argument("Edge weight 0 means no edge.");
+        }
+        setWeight(from, to, weight);
+    }
+
+    bool DynamicShortestPaths::removeEdge(int from, int to) {
+        int numVertices = graph.getNumVertices();
+        if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+            throw std::out_of_range("Edge endpoint is out of range.");
+        }
+        if (graph.getAdjacencyMatrix()[from][to] == 0) {
+            return false;
+        }
+        setWeight(from, to, 0);
+        return true;
+    }
+
+    const ShortestPathTree& DynamicShortestPaths::tree(int source) {
+        refresh();
+        auto found = trees.find(source);
+        if (found == trees.end()) {
+            throw std::invalid_argument("Source is not registered.");
+        }
+        return found->second;
+    }
+
+    long long DynamicShortestPaths::distance(int source, int target) {
+        const ShortestPathTree& t = tree(source);
+        if (target < 0 || target >= static_cast<int>(t.distances.size())) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        return t.distances[target];
+    }
+
+    void DynamicShortestPaths::refresh() {
+        if (version == graph.getVersion()) return;
+        negativeWeights = 0;
+        for (const std::vector<int>& row : graph.getAdjacencyMatrix()) {
+            negativeWeights += std::count_if(row.begin(), row.end(), [](int weight) { return weight < 0; });
+        }
+        for (auto& entry : trees) {
+            Algorithms::shortestPathTree(graph, entry.first, entry.second);
+        }
+        version = graph.getVersion();
+    }
+
+    // from -> to got cheaper (or appeared): only vertices it brings closer change
+    void DynamicShortestPaths::decrease(ShortestPathTree& t, int from, int to, int weight) {
+        if (t.distances[from] == LLONG_MAX || t.distances[from] + weight >= t.distances[to]) return;
+        t.distances[to] = t.distances[from] + weight;
+        t.parents[to] = from;
+        heap.clear();
+        heap.emplace_back(t.distances[to], to);
+        propagate(t);
+    }
+
+    // from -> to got dearer (or disappeared): if it is a tree edge, the subtree below
+    // it is reset and seeded with its best edges from outside, whose distances stand
+    void DynamicShortestPaths::increase(ShortestPathTree& t, int from, int to) {
+        if (t.parents[to] != from) return;
+        int numVertices = graph.getNumVertices();
+        side.assign(numVertices, 0);
+        side[to] = 1;
+        side[t.source] = 2;
+        affected.clear();
+        for (int v = 0; v < numVertices; ++v) {
+            int at = v;
+            walk.clear();
+            while (side[at] == 0 && t.parents[at] != -1) {
+                walk.push_back(at);
+                at = t.parents[at];
+            }
+            int result = side[at] == 0 ? 2 : side[at];
+            side[at] = result;
+            for (int w : walk) side[w] = result;
+        }
+        for (int v = 0; v < numVertices; ++v) {
+            if (side[v] == 1) {
+                affected.push_back(v);
+                t.distances[v] = LLONG_MAX;
+                t.parents[v] = -1;
+            }
+        }
+
+        const std::vector<std::vector<int>>& adjacencyMatrix = graph.getAdjacencyMatrix();
+        heap.clear();
+        for (int v : affected) {
+            for (int u = 0; u < numVertices; ++u) {
+                int weight = adjacencyMatrix[u][v];
+                if (weight != 0 && side[u] == 2 && t.distances[u] != LLONG_MAX && t.distances[u] + weight < t.distances[v]) {
+                    t.distances[v] = t.distances[u] + weight;
+                    t.parents[v] = u;
+                }
+            }
+            if (t.distances[v] != LLONG_MAX) heap.emplace_back(t.distances[v], v);
+        }
+        std::make_heap(heap.begin(), heap.end(), std::greater<std::pair<long long, int>>());
+        propagate(t);
+    }
+
+    // Dijkstra from the seeded vertices; it only reaches vertices whose distance drops
+    void DynamicShortestPaths::propagate(ShortestPathTree& t) {
+        const std::vector<std::vector<int>>& adjacencyMatrix = graph.getAdjacencyMatrix();
+        std::greater<std::pair<long long, int>> later;
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            std::pair<long long, int> top = heap.back();
+            heap.pop_back();
+            int u = top.second;
+            if (top.first != t.distances[u]) continue;
+            const std::vector<int>& row = adjacencyMatrix[u];
+            for (int v = 0; v < static_cast<int>(row.size()); ++v) {
+                if (row[v] != 0 && v != u && top.first + row[v] < t.distances[v]) {
+                    t.distances[v] = top.first + row[v];
+                    t.parents[v] = u;
+                    heap.emplace_back(t.distances[v], v);
+                    std::push_heap(heap.begin(), heap.end(), later);
+                }
+            }
+        }
+    }
+}
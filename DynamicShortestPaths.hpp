@@ -0,0 +1,53 @@
+#ifndef DYNAMICSHORTESTPATHS_HPP
+#define DYNAMICSHORTESTPATHS_HPP
+
+#include <map>
+#include <vector>
+#include "Graph.hpp"
+#include "Algorithms.hpp"
+
+namespace ariel {
+    // Shortest-path trees for registered sources, kept current while edge weights
+    // change (Ramalingam-Reps style). Edits made through setWeight/addEdge/removeEdge
+    // update the graph and repair every tree: a cheaper edge propagates the
+    // improvement from its head with Dijkstra over the vertices that get closer,
+    // and a dearer tree edge recomputes only the subtree below it from the
+    // distances of the vertices outside. Other edits leave the trees untouched.
+    // While the graph has negative weights, trees are recomputed from scratch
+    // instead. Edits made directly on the graph are noticed through its version
+    // and also recompute every tree.
+    class DynamicShortestPaths {
+    public:
+        explicit DynamicShortestPaths(Graph& g);
+
+        void addSource(int source);
+        void removeSource(int source);
+
+        void setWeight(int from, int to, int weight); // 0 removes the edge
+        void addEdge(int from, int to, int weight = 1);
+        bool removeEdge(int from, int to); // false when there was no edge
+
+        // Throw std::invalid_argument for sources that were not added
+        const ShortestPathTree& tree(int source);
+        long long distance(int source, int target); // LLONG_MAX when unreachable
+
+    private:
+        void refresh();
+        void decrease(ShortestPathTree& t, int from, int to, int weight);
+        void increase(ShortestPathTree& t, int from, int to);
+        void propagate(ShortestPathTree& t);
+
+        Graph& graph;
+        unsigned long long version; // graph version the trees describe
+        int negativeWeights;        // negative entries in the matrix
+        std::map<int, ShortestPathTree> trees;
+
+        // Scratch for repairs
+        std::vector<int> side; // 0 unknown, 1 below the changed edge, 2 elsewhere
+        std::vector<int> walk;
+        std::vector<int> affected;
+        std::vector<std::pair<long long, int>> heap;
+    };
+}
+
+#endif
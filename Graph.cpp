@@ -1,266 +1,669 @@
-#include "Graph.hpp"
-#include <iostream>
-#include <stdexcept>
-
-namespace ariel {
-    Graph::Graph() : numVertices(0), numEdges(0), isDirected(true) {}
-
-    void Graph::loadGraph(const std::vector<std::vector<int>>& graph) {
-        int rows = graph.size();
-        int cols = graph[0].size();
-
-        if (rows != cols) {
-            throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
-        }
-
-        adjacencyMatrix = graph;
-        numVertices = rows;
-        isDirected = false; // Assume undirected until proven otherwise
-
-        // Check for symmetry and count edges
-        numEdges = 0;
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                if (adjacencyMatrix[i][j] != adjacencyMatrix[j][i]) {
-                    isDirected = true; // If any asymmetric entry is found, it's a directed graph
-                }
-                if (adjacencyMatrix[i][j] != 0) {
-                    ++numEdges;
-                }
-            }
-        }
-        if (!isDirected) {
-            numEdges /= 2; // Divide by 2 for undirected graphs
-        }
-    }
-
-    void Graph::printGraph() const {
-        std::cout << "Graph with " << numVertices << " vertices and " << numEdges << " edges";
-        if (isDirected) {
-            std::cout << " (Directed)" << std::endl;
-        } else {
-            std::cout << " (Undirected)" << std::endl;
-        }
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                std::cout << adjacencyMatrix[i][j] << " ";
-            }
-            std::cout << std::endl;
-        }
-        std::cout << std::endl;
-    }
-
-    int Graph::getNumVertices() const {
-        return numVertices;
-    }
-
-    int Graph::getNumEdges() const {
-        return numEdges;
-    }
-
-    const std::vector<std::vector<int>>& Graph::getAdjacencyMatrix() const {
-        return adjacencyMatrix;
-    }
-
-    // Addition operator
-    Graph Graph::operator+(const Graph& other) const {
-        if (numVertices != other.numVertices) {
-            throw std::invalid_argument("Graphs must be of the same size for addition.");
-        }
-        Graph result;
-        result.numVertices = numVertices;
-        result.isDirected = isDirected;
-        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                result.adjacencyMatrix[i][j] = adjacencyMatrix[i][j] + other.adjacencyMatrix[i][j];
-            }
-        }
-        return result;
-    }
-
-    // Addition assignment operator
-    Graph& Graph::operator+=(const Graph& other) {
-        if (numVertices != other.numVertices) {
-            throw std::invalid_argument("Graphs must be of the same size for addition.");
-        }
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                adjacencyMatrix[i][j] += other.adjacencyMatrix[i][j];
-            }
-        }
-        return *this;
-    }
-
-    // Subtraction operator
-    Graph Graph::operator-(const Graph& other) const {
-        if (numVertices != other.numVertices) {
-            throw std::invalid_argument("Graphs must be of the same size for subtraction.");
-        }
-        Graph result;
-        result.numVertices = numVertices;
-        result.isDirected = isDirected;
-        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                result.adjacencyMatrix[i][j] = adjacencyMatrix[i][j] - other.adjacencyMatrix[i][j];
-            }
-        }
-        return result;
-    }
-
-    // Subtraction assignment operator
-    Graph& Graph::operator-=(const Graph& other) {
-        if (numVertices != other.numVertices) {
-            throw std::invalid_argument("Graphs must be of the same size for subtraction.");
-        }
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                adjacencyMatrix[i][j] -= other.adjacencyMatrix[i][j];
-            }
-        }
-        return *this;
-    }
-
-    // Unary plus operator
-    Graph Graph::operator+() const {
-        return *this;
-    }
-
-    // Unary minus operator
-    Graph Graph::operator-() const {
-        Graph result;
-        result.numVertices = numVertices;
-        result.isDirected = isDirected;
-        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                result.adjacencyMatrix[i][j] = -adjacencyMatrix[i][j];
-            }
-        }
-        return result;
-    }
-
-    // Comparison operators
-    bool Graph::operator==(const Graph& other) const {
-        return (numVertices == other.numVertices && adjacencyMatrix == other.adjacencyMatrix);
-    }
-
-    bool Graph::operator!=(const Graph& other) const {
-        return !(*this == other);
-    }
-
-    bool Graph::operator>(const Graph& other) const {
-        if (*this == other) return false;
-        if (numEdges > other.numEdges) return true;
-        if (numEdges < other.numEdges) return false;
-        return adjacencyMatrix > other.adjacencyMatrix;
-    }
-
-    bool Graph::operator>=(const Graph& other) const {
-        return (*this > other || *this == other);
-    }
-
-    bool Graph::operator<(const Graph& other) const {
-        return !(*this >= other);
-    }
-
-    bool Graph::operator<=(const Graph& other) const {
-        return !(*this > other);
-    }
-
-    // Prefix increment operator
-    Graph& Graph::operator++() {
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                ++adjacencyMatrix[i][j];
-            }
-        }
-        return *this;
-    }
-
-    // Postfix increment operator
-    Graph Graph::operator++(int) {
-        Graph temp = *this;
-        ++(*this);
-        return temp;
-    }
-
-    // Prefix decrement operator
-    Graph& Graph::operator--() {
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                --adjacencyMatrix[i][j];
-            }
-        }
-        return *this;
-    }
-
-    // Postfix decrement operator
-    Graph Graph::operator--(int) {
-        Graph temp = *this;
-        --(*this);
-        return temp;
-    }
-
-    // Multiplication by an integer scalar
-    Graph Graph::operator*(int scalar) const {
-        Graph result;
-        result.numVertices = numVertices;
-        result.isDirected = isDirected;
-        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                result.adjacencyMatrix[i][j] = adjacencyMatrix[i][j] * scalar;
-            }
-        }
-        return result;
-    }
-
-    Graph& Graph::operator*=(int scalar) {
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                adjacencyMatrix[i][j] *= scalar;
-            }
-        }
-        return *this;
-    }
-
-    // Graph multiplication
-    Graph Graph::operator*(const Graph& other) const {
-        if (numVertices != other.numVertices) {
-            throw std::invalid_argument("Graphs must be of the same size for multiplication.");
-        }
-        Graph result;
-        result.numVertices = numVertices;
-        result.isDirected = isDirected;
-        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
-        for (int i = 0; i < numVertices; ++i) {
-            for (int j = 0; j < numVertices; ++j) {
-                for (int k = 0; k < numVertices; ++k) {
-                    result.adjacencyMatrix[i][j] += adjacencyMatrix[i][k] * other.adjacencyMatrix[k][j];
-                }
-            }
-        }
-        return result;
-    }
-
-    // Output operator
-   // Output operator
-std::ostream& operator<<(std::ostream& os, const Graph& graph) {
-    os << "Graph with " << graph.numVertices << " vertices and " << graph.numEdges << " edges";
-    if (graph.isDirected) {
-        os << " (Directed)" << std::endl;
-    } else {
-        os << " (Undirected)" << std::endl;
-    }
-    for (int i = 0; i < graph.numVertices; ++i) {
-        for (int j = 0; j < graph.numVertices; ++j) {
-            os << graph.adjacencyMatrix[i][j] << " ";
-        }
-        os << std::endl;
-    }
-    return os;
-}
-
-}
+#include "Graph.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <cmath>
+#include <cstdlib>
+#include <mutex>
+#include <atomic>
+
+namespace ariel {
+    namespace {
+        // Neighbour lists of the underlying undirected graph, sorted by id.
+        std::vector<std::vector<int>> undirectedNeighbors(const std::vector<std::vector<int>>& matrix) {
+            int numVertices = matrix.size();
+            std::vector<std::vector<int>> neighbors(numVertices);
+            for (int i = 0; i < numVertices; ++i) {
+                for (int j = 0; j < numVertices; ++j) {
+                    if (i != j && (matrix[i][j] != 0 || matrix[j][i] != 0)) {
+                        neighbors[i].push_back(j);
+                    }
+                }
+            }
+            return neighbors;
+        }
+
+        VertexOrdering makeOrdering(std::vector<int> permutation) {
+            VertexOrdering ordering;
+            ordering.inverse.assign(permutation.size(), -1);
+            for (size_t i = 0; i < permutation.size(); ++i) {
+                ordering.inverse[permutation[i]] = i;
+            }
+            ordering.permutation = std::move(permutation);
+            return ordering;
+        }
+
+        // BFS from start; returns the depth of the last level and its lowest-degree vertex.
+        std::pair<int, int> lastLevel(const std::vector<std::vector<int>>& neighbors, int start, std::vector<int>& level) {
+            std::vector<int> visited;
+            visited.push_back(start);
+            level[start] = 0;
+            for (size_t head = 0; head < visited.size(); ++head) {
+                int u = visited[head];
+                for (int v : neighbors[u]) {
+                    if (level[v] == -1) {
+                        level[v] = level[u] + 1;
+                        visited.push_back(v);
+                    }
+                }
+            }
+            int depth = level[visited.back()];
+            int best = visited.back();
+            for (int v : visited) {
+                if (level[v] == depth && neighbors[v].size() < neighbors[best].size()) {
+                    best = v;
+                }
+                level[v] = -1;
+            }
+            return {depth, best};
+        }
+    }
+
+    struct Graph::Derived {
+        std::once_flag adjacencyOnce;
+        AdjacencyList adjacency;
+        std::once_flag reverseOnce;
+        AdjacencyList reverse;
+        std::once_flag weightsOnce;
+        bool negativeWeights = false;
+        std::once_flag symmetryOnce;
+        bool directed = false;
+    };
+
+    namespace {
+        std::atomic<unsigned long long> nextVersion(1);
+    }
+
+    Graph::Graph()
+        : numVertices(0), numEdges(0), isDirected(true), nonZeroEntries(0), asymmetricPairs(-1), version(nextVersion++) {}
+
+    Graph::Graph(const Graph& other)
+        : numVertices(other.numVertices), numEdges(other.numEdges), isDirected(other.isDirected),
+          nonZeroEntries(other.nonZeroEntries), asymmetricPairs(other.asymmetricPairs), adjacencyMatrix(other.adjacencyMatrix), derivedCache(std::atomic_load(&other.derivedCache)),
+          version(other.version) {}
+
+    Graph& Graph::operator=(const Graph& other) {
+        if (this != &other) {
+            numVertices = other.numVertices;
+            numEdges = other.numEdges;
+            isDirected = other.isDirected;
+            nonZeroEntries = other.nonZeroEntries;
+            asymmetricPairs = other.asymmetricPairs;
+            adjacencyMatrix = other.adjacencyMatrix;
+            std::atomic_store(&derivedCache, std::atomic_load(&other.derivedCache));
+            version = other.version;
+        }
+        return *this;
+    }
+
+    Graph::Derived& Graph::derived() const {
+        std::shared_ptr<Derived> current = std::atomic_load(&derivedCache);
+        if (!current) {
+            std::shared_ptr<Derived> fresh = std::make_shared<Derived>();
+            if (std::atomic_compare_exchange_strong(&derivedCache, &current, fresh)) {
+                current = fresh;
+            }
+        }
+        return *current;
+    }
+
+    void Graph::invalidate() {
+        std::atomic_store(&derivedCache, std::shared_ptr<Derived>());
+        version = nextVersion++;
+    }
+
+    unsigned long long Graph::getVersion() const {
+        return version;
+    }
+
+    const AdjacencyList& Graph::getAdjacencyList() const {
+        Derived& cache = derived();
+        std::call_once(cache.adjacencyOnce, [&]() {
+            AdjacencyList& list = cache.adjacency;
+            list.offsets.assign(1, 0);
+            list.offsets.reserve(numVertices + 1);
+            for (int i = 0; i < numVertices; ++i) {
+                for (int j = 0; j < numVertices; ++j) {
+                    if (adjacencyMatrix[i][j] != 0) {
+                        list.targets.push_back(j);
+                        list.weights.push_back(adjacencyMatrix[i][j]);
+                    }
+                }
+                list.offsets.push_back(list.targets.size());
+            }
+        });
+        return cache.adjacency;
+    }
+
+    // Counting sort of the forward CSR by target
+    const AdjacencyList& Graph::getReverseAdjacencyList() const {
+        const AdjacencyList& forward = getAdjacencyList();
+        Derived& cache = derived();
+        std::call_once(cache.reverseOnce, [&]() {
+            AdjacencyList& list = cache.reverse;
+            list.offsets.assign(numVertices + 1, 0);
+            for (int target : forward.targets) {
+                ++list.offsets[target + 1];
+            }
+            for (int v = 0; v < numVertices; ++v) {
+                list.offsets[v + 1] += list.offsets[v];
+            }
+            list.targets.resize(forward.targets.size());
+            list.weights.resize(forward.weights.size());
+            std::vector<int> next(list.offsets.begin(), list.offsets.end() - 1);
+            for (int u = 0; u < numVertices; ++u) {
+                for (int e = forward.offsets[u]; e < forward.offsets[u + 1]; ++e) {
+                    int slot = next[forward.targets[e]]++;
+                    list.targets[slot] = u;
+                    list.weights[slot] = forward.weights[e];
+                }
+            }
+        });
+        return cache.reverse;
+    }
+
+    bool Graph::hasNegativeWeights() const {
+        Derived& cache = derived();
+        std::call_once(cache.weightsOnce, [&]() {
+            for (int i = 0; i < numVertices && !cache.negativeWeights; ++i) {
+                for (int j = 0; j < numVertices; ++j) {
+                    if (adjacencyMatrix[i][j] < 0) {
+                        cache.negativeWeights = true;
+                        break;
+                    }
+                }
+            }
+        });
+        return cache.negativeWeights;
+    }
+
+    bool Graph::isDirectedGraph() const {
+        Derived& cache = derived();
+        std::call_once(cache.symmetryOnce, [&]() {
+            for (int i = 0; i < numVertices && !cache.directed; ++i) {
+                for (int j = i + 1; j < numVertices; ++j) {
+                    if (adjacencyMatrix[i][j] != adjacencyMatrix[j][i]) {
+                        cache.directed = true;
+                        break;
+                    }
+                }
+            }
+        });
+        return cache.directed;
+    }
+
+    void Graph::loadGraph(const std::vector<std::vector<int>>& graph) {
+        int rows = graph.size();
+        int cols = graph[0].size();
+
+        if (rows != cols) {
+            throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
+        }
+
+        adjacencyMatrix = graph;
+        invalidate();
+        numVertices = rows;
+        countEntries();
+        updateEdgeCount();
+    }
+
+    // Check for symmetry and count the non-zero entries
+    void Graph::countEntries() {
+        nonZeroEntries = 0;
+        asymmetricPairs = 0;
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                if (i < j && adjacencyMatrix[i][j] != adjacencyMatrix[j][i]) {
+                    ++asymmetricPairs;
+                }
+                if (adjacencyMatrix[i][j] != 0) {
+                    ++nonZeroEntries;
+                }
+            }
+        }
+    }
+
+    // Any asymmetric pair makes the graph directed; undirected graphs count each pair once
+    void Graph::updateEdgeCount() {
+        isDirected = asymmetricPairs > 0;
+        numEdges = isDirected ? nonZeroEntries : nonZeroEntries / 2;
+    }
+
+    // Keeps the entry counts current in O(1), so the edge count and direction match
+    // what loadGraph reports for the edited matrix. Counts an operator left unknown
+    // are rebuilt first.
+    void Graph::setEntry(int from, int to, int weight) {
+        if (asymmetricPairs < 0) {
+            countEntries();
+        }
+        int& entry = adjacencyMatrix[from][to];
+        nonZeroEntries += (weight != 0) - (entry != 0);
+        if (from != to) {
+            int mirror = adjacencyMatrix[to][from];
+            asymmetricPairs += (weight != mirror) - (entry != mirror);
+        }
+        entry = weight;
+        updateEdgeCount();
+        invalidate();
+    }
+
+    void Graph::addEdge(int from, int to, int weight) {
+        if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+            throw std::out_of_range("Edge endpoint is out of range.");
+        }
+        if (weight == 0) {
+            throw std::invalid_argument("Edge weight 0 means no edge.");
+        }
+        setEntry(from, to, weight);
+    }
+
+    bool Graph::removeEdge(int from, int to) {
+        if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+            throw std::out_of_range("Edge endpoint is out of range.");
+        }
+        if (adjacencyMatrix[from][to] == 0) {
+            return false;
+        }
+        setEntry(from, to, 0);
+        return true;
+    }
+
+    void Graph::printGraph() const {
+        std::cout << "Graph with " << numVertices << " vertices and " << numEdges << " edges";
+        if (isDirected) {
+            std::cout << " (Directed)\n";
+        } else {
+            std::cout << " (Undirected)\n";
+        }
+        write(std::cout);
+        std::cout << std::endl;
+    }
+
+    int Graph::getNumVertices() const {
+        return numVertices;
+    }
+
+    int Graph::getNumEdges() const {
+        return numEdges;
+    }
+
+    const std::vector<std::vector<int>>& Graph::getAdjacencyMatrix() const {
+        return adjacencyMatrix;
+    }
+
+    // Reverse Cuthill-McKee: BFS from a pseudo-peripheral vertex of each component,
+    // visiting neighbours by increasing degree, then reversed to reduce bandwidth
+    VertexOrdering Graph::reverseCuthillMcKee() const {
+        std::vector<std::vector<int>> neighbors = undirectedNeighbors(adjacencyMatrix);
+        auto byDegree = [&](int a, int b) {
+            if (neighbors[a].size() != neighbors[b].size()) return neighbors[a].size() < neighbors[b].size();
+            return a < b;
+        };
+
+        std::vector<int> seeds(numVertices);
+        std::iota(seeds.begin(), seeds.end(), 0);
+        std::sort(seeds.begin(), seeds.end(), byDegree);
+
+        std::vector<int> order;
+        order.reserve(numVertices);
+        std::vector<bool> placed(numVertices, false);
+        std::vector<int> level(numVertices, -1);
+
+        for (int seed : seeds) {
+            if (placed[seed]) continue;
+
+            // George-Liu search for a pseudo-peripheral start vertex
+            int start = seed;
+            std::pair<int, int> last = lastLevel(neighbors, start, level);
+            while (true) {
+                std::pair<int, int> next = lastLevel(neighbors, last.second, level);
+                if (next.first <= last.first) break;
+                start = last.second;
+                last = next;
+            }
+
+            placed[start] = true;
+            order.push_back(start);
+            for (size_t head = order.size() - 1; head < order.size(); ++head) {
+                int u = order[head];
+                size_t first = order.size();
+                for (int v : neighbors[u]) {
+                    if (!placed[v]) {
+                        placed[v] = true;
+                        order.push_back(v);
+                    }
+                }
+                std::sort(order.begin() + first, order.end(), byDegree);
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+        return makeOrdering(std::move(order));
+    }
+
+    // Hub-first ordering by decreasing degree, ties keep the original order
+    VertexOrdering Graph::degreeOrdering() const {
+        std::vector<int> degree(numVertices, 0);
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                if (adjacencyMatrix[i][j] != 0) {
+                    ++degree[i];
+                    ++degree[j];
+                }
+            }
+        }
+        std::vector<int> order(numVertices);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return degree[a] > degree[b]; });
+        return makeOrdering(std::move(order));
+    }
+
+    // Gorder-style greedy placement: the next vertex is the one sharing the most
+    // edges and common neighbours with the last `window` placed vertices
+    VertexOrdering Graph::gorderOrdering(int window) const {
+        if (window < 1) {
+            throw std::invalid_argument("Window size must be positive.");
+        }
+        std::vector<std::vector<int>> neighbors = undirectedNeighbors(adjacencyMatrix);
+        // Common neighbours through hubs say little about locality and cost O(deg^2)
+        size_t hubDegree = std::max(16, static_cast<int>(std::sqrt(numVertices)));
+
+        std::vector<int> score(numVertices, 0);
+        std::vector<bool> placed(numVertices, false);
+        std::priority_queue<std::pair<int, int>> heap; // (score, -vertex), stale entries skipped
+        for (int v = 0; v < numVertices; ++v) {
+            heap.push({0, -v});
+        }
+
+        auto bump = [&](int x, int delta) {
+            if (!placed[x]) {
+                score[x] += delta;
+                heap.push({score[x], -x});
+            }
+        };
+        auto adjust = [&](int u, int delta) {
+            for (int x : neighbors[u]) {
+                bump(x, delta);
+            }
+            for (int y : neighbors[u]) {
+                if (neighbors[y].size() > hubDegree) continue;
+                for (int x : neighbors[y]) {
+                    if (x != u) bump(x, delta);
+                }
+            }
+        };
+
+        std::vector<int> order;
+        order.reserve(numVertices);
+        auto place = [&](int v) {
+            placed[v] = true;
+            order.push_back(v);
+            adjust(v, 1);
+            if (static_cast<int>(order.size()) > window) {
+                adjust(order[order.size() - 1 - window], -1);
+            }
+        };
+
+        if (numVertices > 0) {
+            int start = 0;
+            for (int v = 1; v < numVertices; ++v) {
+                if (neighbors[v].size() > neighbors[start].size()) start = v;
+            }
+            place(start);
+        }
+        while (static_cast<int>(order.size()) < numVertices) {
+            std::pair<int, int> top = heap.top();
+            heap.pop();
+            int v = -top.second;
+            if (placed[v] || top.first != score[v]) continue;
+            place(v);
+        }
+        return makeOrdering(std::move(order));
+    }
+
+    // Relabels vertices so that new vertex i is the original ordering.permutation[i]
+    Graph Graph::reordered(const VertexOrdering& ordering) const {
+        const std::vector<int>& perm = ordering.permutation;
+        if (static_cast<int>(perm.size()) != numVertices || ordering.inverse.size() != perm.size()) {
+            throw std::invalid_argument("Ordering size must match the number of vertices.");
+        }
+        for (int i = 0; i < numVertices; ++i) {
+            if (perm[i] < 0 || perm[i] >= numVertices || ordering.inverse[perm[i]] != i) {
+                throw std::invalid_argument("Ordering is not a valid permutation.");
+            }
+        }
+        Graph result;
+        result.numVertices = numVertices;
+        result.numEdges = numEdges;
+        result.isDirected = isDirected;
+        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
+        for (int i = 0; i < numVertices; ++i) {
+            const std::vector<int>& row = adjacencyMatrix[perm[i]];
+            for (int j = 0; j < numVertices; ++j) {
+                result.adjacencyMatrix[i][j] = row[perm[j]];
+            }
+        }
+        return result;
+    }
+
+    // Largest |i - j| over all edges (i, j)
+    int Graph::getBandwidth() const {
+        int bandwidth = 0;
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                if (adjacencyMatrix[i][j] != 0) {
+                    bandwidth = std::max(bandwidth, std::abs(i - j));
+                }
+            }
+        }
+        return bandwidth;
+    }
+
+    // Addition operator
+    Graph Graph::operator+(const Graph& other) const {
+        if (numVertices != other.numVertices) {
+            throw std::invalid_argument("Graphs must be of the same size for addition.");
+        }
+        Graph result;
+        result.numVertices = numVertices;
+        result.isDirected = isDirected;
+        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                result.adjacencyMatrix[i][j] = adjacencyMatrix[i][j] + other.adjacencyMatrix[i][j];
+            }
+        }
+        return result;
+    }
+
+    // Addition assignment operator
+    Graph& Graph::operator+=(const Graph& other) {
+        if (numVertices != other.numVertices) {
+            throw std::invalid_argument("Graphs must be of the same size for addition.");
+        }
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                adjacencyMatrix[i][j] += other.adjacencyMatrix[i][j];
+            }
+        }
+        asymmetricPairs = -1;
+        invalidate();
+        return *this;
+    }
+
+    // Subtraction operator
+    Graph Graph::operator-(const Graph& other) const {
+        if (numVertices != other.numVertices) {
+            throw std::invalid_argument("Graphs must be of the same size for subtraction.");
+        }
+        Graph result;
+        result.numVertices = numVertices;
+        result.isDirected = isDirected;
+        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                result.adjacencyMatrix[i][j] = adjacencyMatrix[i][j] - other.adjacencyMatrix[i][j];
+            }
+        }
+        return result;
+    }
+
+    // Subtraction assignment operator
+    Graph& Graph::operator-=(const Graph& other) {
+        if (numVertices != other.numVertices) {
+            throw std::invalid_argument("Graphs must be of the same size for subtraction.");
+        }
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                adjacencyMatrix[i][j] -= other.adjacencyMatrix[i][j];
+            }
+        }
+        asymmetricPairs = -1;
+        invalidate();
+        return *this;
+    }
+
+    // Unary plus operator
+    Graph Graph::operator+() const {
+        return *this;
+    }
+
+    // Unary minus operator
+    Graph Graph::operator-() const {
+        Graph result;
+        result.numVertices = numVertices;
+        result.isDirected = isDirected;
+        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                result.adjacencyMatrix[i][j] = -adjacencyMatrix[i][j];
+            }
+        }
+        return result;
+    }
+
+    // Comparison operators
+    bool Graph::operator==(const Graph& other) const {
+        return (numVertices == other.numVertices && adjacencyMatrix == other.adjacencyMatrix);
+    }
+
+    bool Graph::operator!=(const Graph& other) const {
+        return !(*this == other);
+    }
+
+    bool Graph::operator>(const Graph& other) const {
+        if (*this == other) return false;
+        if (numEdges > other.numEdges) return true;
+        if (numEdges < other.numEdges) return false;
+        return adjacencyMatrix > other.adjacencyMatrix;
+    }
+
+    bool Graph::operator>=(const Graph& other) const {
+        return (*this > other || *this == other);
+    }
+
+    bool Graph::operator<(const Graph& other) const {
+        return !(*this >= other);
+    }
+
+    bool Graph::operator<=(const Graph& other) const {
+        return !(*this > other);
+    }
+
+    // Prefix increment operator
+    Graph& Graph::operator++() {
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                ++adjacencyMatrix[i][j];
+            }
+        }
+        asymmetricPairs = -1;
+        invalidate();
+        return *this;
+    }
+
+    // Postfix increment operator
+    Graph Graph::operator++(int) {
+        Graph temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    // Prefix decrement operator
+    Graph& Graph::operator--() {
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                --adjacencyMatrix[i][j];
+            }
+        }
+        asymmetricPairs = -1;
+        invalidate();
+        return *this;
+    }
+
+    // Postfix decrement operator
+    Graph Graph::operator--(int) {
+        Graph temp = *this;
+        --(*this);
+        return temp;
+    }
+
+    // Multiplication by an integer scalar
+    Graph Graph::operator*(int scalar) const {
+        Graph result;
+        result.numVertices = numVertices;
+        result.isDirected = isDirected;
+        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                result.adjacencyMatrix[i][j] = adjacencyMatrix[i][j] * scalar;
+            }
+        }
+        return result;
+    }
+
+    Graph& Graph::operator*=(int scalar) {
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                adjacencyMatrix[i][j] *= scalar;
+            }
+        }
+        asymmetricPairs = -1;
+        invalidate();
+        return *this;
+    }
+
+    // Graph multiplication
+    Graph Graph::operator*(const Graph& other) const {
+        if (numVertices != other.numVertices) {
+            throw std::invalid_argument("Graphs must be of the same size for multiplication.");
+        }
+        Graph result;
+        result.numVertices = numVertices;
+        result.isDirected = isDirected;
+        result.adjacencyMatrix.resize(numVertices, std::vector<int>(numVertices, 0));
+        for (int i = 0; i < numVertices; ++i) {
+            for (int j = 0; j < numVertices; ++j) {
+                for (int k = 0; k < numVertices; ++k) {
+                    result.adjacencyMatrix[i][j] += adjacencyMatrix[i][k] * other.adjacencyMatrix[k][j];
+                }
+            }
+        }
+        return result;
+    }
+
+    // Output operator
+    std::ostream& operator<<(std::ostream& os, const Graph& graph) {
+        os << "Graph with " << graph.numVertices << " vertices and " << graph.numEdges << " edges";
+        if (graph.isDirected) {
+            os << " (Directed)\n";
+        } else {
+            os << " (Undirected)\n";
+        }
+        graph.write(os);
+        return os;
+    }
+
+}
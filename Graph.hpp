@@ -1,54 +1,122 @@
-#ifndef GRAPH_HPP
-#define GRAPH_HPP
-
-#include <vector>
-#include <stdexcept>
-
-namespace ariel {
-    class Graph {
-    public:
-        Graph();
-       
-        void loadGraph(const std::vector<std::vector<int>>& graph);
-        void printGraph() const;
-        int getNumVertices() const;
-        int getNumEdges() const;
-        const std::vector<std::vector<int>>& getAdjacencyMatrix() const;
-
-        // Operator overloading
-        Graph operator+(const Graph& other) const;
-        Graph& operator+=(const Graph& other);
-        Graph operator-(const Graph& other) const;
-        Graph& operator-=(const Graph& other);
-        Graph operator+() const;
-        Graph operator-() const;
-
-        // Comparison operators
-        bool operator==(const Graph& other) const;
-        bool operator!=(const Graph& other) const;
-        bool operator>(const Graph& other) const;
-        bool operator>=(const Graph& other) const;
-        bool operator<(const Graph& other) const;
-        bool operator<=(const Graph& other) const;
-
-        // Increment and decrement operators
-        Graph& operator++();    // Prefix increment
-        Graph operator++(int);  // Postfix increment
-        Graph& operator--();    // Prefix decrement
-        Graph operator--(int);  // Postfix decrement
-  // Multiplication operators
-        Graph operator*(int scalar) const;
-        Graph& operator*=(int scalar);
-        Graph operator*(const Graph& other) const;
-
-        // Output operator
-        friend std::ostream& operator<<(std::ostream& os, const Graph& graph);
-    private:
-        int numVertices;
-        int numEdges;
-        bool isDirected;
-        std::vector<std::vector<int>> adjacencyMatrix;
-    };
-}
-
-#endif
+#ifndef GRAPH_HPP
+#define GRAPH_HPP
+
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include <memory>
+#include <stdexcept>
+
+namespace ariel {
+    // Vertex relabelling produced by the reordering passes.
+    // permutation[newId] is the original vertex placed at newId and
+    // inverse[originalId] is the new id of that vertex.
+    struct VertexOrdering {
+        std::vector<int> permutation;
+        std::vector<int> inverse;
+    };
+
+    // Compressed sparse row view of the non-zero matrix entries
+    struct AdjacencyList {
+        std::vector<int> offsets;  // row u occupies [offsets[u], offsets[u + 1])
+        std::vector<int> targets;
+        std::vector<int> weights;
+    };
+
+    class Graph {
+    public:
+        // Body layouts for write/writeToFile: the full matrix, or one "u v w" line per non-zero entry
+        enum class OutputFormat { Matrix, EdgeList };
+
+        Graph();
+        // Copies share the source's cached views; the cache pointer is read atomically
+        // so that copying is safe while other threads fill the source's cache
+        Graph(const Graph& other);
+        Graph& operator=(const Graph& other);
+        Graph(Graph&& other) = default;
+        Graph& operator=(Graph&& other) = default;
+       
+        void loadGraph(const std::vector<std::vector<int>>& graph);
+        // Parses a whitespace-separated square matrix file (one row per line) in parallel
+        void loadFromFile(const std::string& path, unsigned threads = 0);
+        void printGraph() const;
+        // Single-entry edits: addEdge sets the weight of from -> to (replacing any
+        // previous weight), removeEdge clears it and returns whether it was set.
+        // For undirected graphs, edit both directions.
+        void addEdge(int from, int to, int weight = 1);
+        bool removeEdge(int from, int to);
+        int getNumVertices() const;
+        int getNumEdges() const;
+        const std::vector<std::vector<int>>& getAdjacencyMatrix() const;
+
+        // Cached views, computed on first use and dropped whenever the graph is modified.
+        // Safe to call from concurrent readers.
+        const AdjacencyList& getAdjacencyList() const;
+        const AdjacencyList& getReverseAdjacencyList() const; // row v lists the sources of edges into v
+        bool hasNegativeWeights() const;
+        bool isDirectedGraph() const; // false when the matrix is symmetric
+        // Stamp identifying the current contents: taken from a process-wide counter on
+        // construction and on every modification, shared by copies until they diverge
+        unsigned long long getVersion() const;
+
+        // Vertex reordering (edges are treated as undirected for locality)
+        VertexOrdering reverseCuthillMcKee() const;
+        VertexOrdering degreeOrdering() const;
+        VertexOrdering gorderOrdering(int window = 5) const;
+        Graph reordered(const VertexOrdering& ordering) const;
+        int getBandwidth() const;
+
+        // Buffered output of the matrix body (no header, no per-row flush)
+        void write(std::ostream& os, OutputFormat format = OutputFormat::Matrix) const;
+        void writeToFile(const std::string& path, OutputFormat format = OutputFormat::Matrix, unsigned threads = 0) const;
+
+        // Operator overloading
+        Graph operator+(const Graph& other) const;
+        Graph& operator+=(const Graph& other);
+        Graph operator-(const Graph& other) const;
+        Graph& operator-=(const Graph& other);
+        Graph operator+() const;
+        Graph operator-() const;
+
+        // Comparison operators
+        bool operator==(const Graph& other) const;
+        bool operator!=(const Graph& other) const;
+        bool operator>(const Graph& other) const;
+        bool operator>=(const Graph& other) const;
+        bool operator<(const Graph& other) const;
+        bool operator<=(const Graph& other) const;
+
+        // Increment and decrement operators
+        Graph& operator++();    // Prefix increment
+        Graph operator++(int);  // Postfix increment
+        Graph& operator--();    // Prefix decrement
+        Graph operator--(int);  // Postfix decrement
+  // Multiplication operators
+        Graph operator*(int scalar) const;
+        Graph& operator*=(int scalar);
+        Graph operator*(const Graph& other) const;
+
+        // Output operator
+        friend std::ostream& operator<<(std::ostream& os, const Graph& graph);
+    private:
+        struct Derived;
+        Derived& derived() const;
+        void invalidate();
+        void countEntries();
+        void updateEdgeCount();
+        void setEntry(int from, int to, int weight);
+
+        int numVertices;
+        int numEdges;
+        bool isDirected;
+        // Non-zero entries and unordered pairs {i, j} whose entries differ, from which
+        // numEdges and isDirected follow; asymmetricPairs is -1 when not counted
+        int nonZeroEntries;
+        int asymmetricPairs;
+        std::vector<std::vector<int>> adjacencyMatrix;
+        mutable std::shared_ptr<Derived> derivedCache; // shared by copies until either is modified
+        unsigned long long version;
+    };
+}
+
+#endif
@@ -0,0 +1,325 @@
+#include "Graph.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <cstring>
+#include <atomic>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace ariel {
+    namespace {
+        const size_t FlushThreshold = 1 << 20;  // bytes buffered before handing them to the stream
+        const int MaxIntChars = 11;             // "-2147483648"
+
+        // Formats matrix rows into a reusable character buffer with std::to_chars
+        class RowFormatter {
+        public:
+            RowFormatter(const std::vector<std::vector<int>>& matrix, Graph::OutputFormat format)
+                : matrix(matrix), format(format), used(0) {}
+
+            void appendRows(int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    appendRow(i);
+                }
+            }
+
+            const char* data() const { return buffer.data(); }
+            size_t size() const { return used; }
+            void clear() { used = 0; }
+
+        private:
+            void appendRow(int i) {
+                const std::vector<int>& row = matrix[i];
+                int numVertices = row.size();
+                if (format == Graph::OutputFormat::Matrix) {
+                    reserve(static_cast<size_t>(numVertices) * (MaxIntChars + 1) + 1);
+                    char* out = buffer.data() + used;
+                    for (int j = 0; j < numVertices; ++j) {
+                        out = std::to_chars(out, out + MaxIntChars, row[j]).ptr;
+                        *out++ = ' ';
+                    }
+                    *out++ = '\n';
+                    used = out - buffer.data();
+                } else {
+                    for (int j = 0; j < numVertices; ++j) {
+                        if (row[j] == 0) continue;
+                        reserve(3 * (MaxIntChars + 1));
+                        char* out = buffer.data() + used;
+                        out = std::to_chars(out, out + MaxIntChars, i).ptr;
+                        *out++ = ' ';
+                        out = std::to_chars(out, out + MaxIntChars, j).ptr;
+                        *out++ = ' ';
+                        out = std::to_chars(out, out + MaxIntChars, row[j]).ptr;
+                        *out++ = '\n';
+                        used = out - buffer.data();
+                    }
+                }
+            }
+
+            void reserve(size_t extra) {
+                if (used + extra > buffer.size()) {
+                    buffer.resize(std::max(buffer.size() * 2, used + extra));
+                }
+            }
+
+            const std::vector<std::vector<int>>& matrix;
+            Graph::OutputFormat format;
+            std::vector<char> buffer;
+            size_t used;
+        };
+
+        // Read-only memory mapping of a whole file
+        class MappedFile {
+        public:
+            explicit MappedFile(const std::string& path) : begin(nullptr), length(0) {
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    throw std::runtime_error("Cannot open file for reading: " + path);
+                }
+                struct stat info;
+                if (::fstat(fd, &info) != 0) {
+                    ::close(fd);
+                    throw std::runtime_error("Cannot stat file: " + path);
+                }
+                length = info.st_size;
+                if (length > 0) {
+                    void* mapping = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (mapping == MAP_FAILED) {
+                        ::close(fd);
+                        throw std::runtime_error("Cannot map file: " + path);
+                    }
+                    ::madvise(mapping, length, MADV_SEQUENTIAL);
+                    begin = static_cast<const char*>(mapping);
+                }
+                ::close(fd);
+            }
+
+            ~MappedFile() {
+                if (begin != nullptr) {
+                    ::munmap(const_cast<char*>(begin), length);
+                }
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            const char* data() const { return begin; }
+            size_t size() const { return length; }
+
+        private:
+            const char* begin;
+            size_t length;
+        };
+
+        inline bool isBlank(char c) {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        // Skips a run of blanks, 16 bytes at a time where SSE2 is available
+        const char* skipBlanks(const char* p, const char* end) {
+#ifdef __SSE2__
+            const __m128i space = _mm_set1_epi8(' ');
+            const __m128i tab = _mm_set1_epi8('\t');
+            const __m128i cr = _mm_set1_epi8('\r');
+            while (end - p >= 16) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(chunk, space),
+                                             _mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, cr)));
+                unsigned mask = ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xffff;
+                if (mask != 0) {
+                    p += __builtin_ctz(mask);
+                    break;
+                }
+                p += 16;
+            }
+#endif
+            while (p < end && isBlank(*p)) ++p;
+            return p;
+        }
+
+        const char* lineEnd(const char* p, const char* end) {
+            const void* newline = std::memchr(p, '\n', end - p);
+            return newline == nullptr ? end : static_cast<const char*>(newline);
+        }
+
+        bool isBlankLine(const char* p, const char* end) {
+            return skipBlanks(p, end) == end;
+        }
+    }
+
+    // The file is mapped and cut into one chunk per thread at line boundaries.
+    // Each thread counts its rows, then parses them straight into the rows of
+    // the new matrix with std::from_chars, counting edges and checking symmetry
+    // against the rows it has already parsed; rows owned by earlier chunks are
+    // compared once all threads are done.
+    void Graph::loadFromFile(const std::string& path, unsigned threads) {
+        MappedFile file(path);
+        const char* begin = file.data();
+        const char* end = begin + file.size();
+
+        int chunks = static_cast<int>(std::min<size_t>(resolveThreads(threads), std::max<size_t>(1, file.size() / 4096)));
+        std::vector<const char*> bounds(chunks + 1, end);
+        bounds[0] = begin;
+        for (int c = 1; c < chunks; ++c) {
+            const char* p = std::max(bounds[c - 1], begin + file.size() * c / chunks);
+            if (p > begin && p[-1] != '\n') {
+                p = lineEnd(p, end);
+                if (p != end) ++p;
+            }
+            bounds[c] = p;
+        }
+
+        // Pass 1: non-blank lines per chunk give each chunk its first row
+        std::vector<int> firstRow(chunks + 1, 0);
+        parallelFor(0, chunks, chunks, [&](unsigned, int chunkBegin, int chunkEnd) {
+            for (int c = chunkBegin; c < chunkEnd; ++c) {
+                int rows = 0;
+                for (const char* p = bounds[c]; p < bounds[c + 1];) {
+                    const char* stop = lineEnd(p, bounds[c + 1]);
+                    if (!isBlankLine(p, stop)) ++rows;
+                    p = stop + (stop < bounds[c + 1]);
+                }
+                firstRow[c + 1] = rows;
+            }
+        });
+        for (int c = 0; c < chunks; ++c) {
+            firstRow[c + 1] += firstRow[c];
+        }
+        int rows = firstRow[chunks];
+        if (rows == 0) {
+            throw std::invalid_argument("Invalid graph: The file contains no rows.");
+        }
+
+        // Pass 2: parse rows in place
+        std::vector<std::vector<int>> matrix(rows);
+        std::vector<long long> edges(chunks, 0);
+        std::atomic<bool> asymmetric(false);
+        std::atomic<int> error(0); // 1 = bad token, 2 = wrong row length
+        parallelFor(0, chunks, chunks, [&](unsigned, int chunkBegin, int chunkEnd) {
+            for (int c = chunkBegin; c < chunkEnd; ++c) {
+                int i = firstRow[c];
+                for (const char* p = bounds[c]; p < bounds[c + 1] && error.load(std::memory_order_relaxed) == 0;) {
+                    const char* stop = lineEnd(p, bounds[c + 1]);
+                    if (isBlankLine(p, stop)) {
+                        p = stop + (stop < bounds[c + 1]);
+                        continue;
+                    }
+                    std::vector<int>& row = matrix[i];
+                    row.resize(rows);
+                    int j = 0;
+                    for (const char* q = skipBlanks(p, stop); q < stop; q = skipBlanks(q, stop)) {
+                        int value = 0;
+                        std::from_chars_result parsed = std::from_chars(q, stop, value);
+                        if (parsed.ec != std::errc() || (parsed.ptr < stop && !isBlank(*parsed.ptr))) {
+                            error = 1;
+                            break;
+                        }
+                        if (j == rows) {
+                            error = 2;
+                            break;
+                        }
+                        row[j] = value;
+                        if (value != 0) ++edges[c];
+                        if (j >= firstRow[c] && j < i && matrix[j][i] != value) {
+                            asymmetric.store(true, std::memory_order_relaxed);
+                        }
+                        ++j;
+                        q = parsed.ptr;
+                    }
+                    if (error.load(std::memory_order_relaxed) == 0 && j != rows) {
+                        error = 2;
+                    }
+                    ++i;
+                    p = stop + (stop < bounds[c + 1]);
+                }
+            }
+        });
+        if (error == 1) {
+            throw std::invalid_argument("Invalid graph: The file contains a token that is not an integer.");
+        }
+        if (error == 2) {
+            throw std::invalid_argument("Invalid graph: The graph is not a square matrix.");
+        }
+
+        // Pairs whose transposed entry lives in an earlier chunk
+        parallelFor(0, chunks, chunks, [&](unsigned, int chunkBegin, int chunkEnd) {
+            for (int c = chunkBegin; c < chunkEnd; ++c) {
+                for (int i = firstRow[c]; i < firstRow[c + 1] && !asymmetric.load(std::memory_order_relaxed); ++i) {
+                    for (int j = 0; j < firstRow[c]; ++j) {
+                        if (matrix[i][j] != matrix[j][i]) {
+                            asymmetric.store(true, std::memory_order_relaxed);
+                            break;
+                        }
+                    }
+                }
+            }
+        });
+
+        long long nonZero = 0;
+        for (long long count : edges) {
+            nonZero += count;
+        }
+        adjacencyMatrix.swap(matrix);
+        invalidate();
+        numVertices = rows;
+        isDirected = asymmetric.load();
+        numEdges = static_cast<int>(isDirected ? nonZero : nonZero / 2);
+        nonZeroEntries = static_cast<int>(nonZero);
+        asymmetricPairs = isDirected ? -1 : 0; // the scan stops at the first asymmetric pair
+    }
+
+    void Graph::write(std::ostream& os, OutputFormat format) const {
+        RowFormatter formatter(adjacencyMatrix, format);
+        for (int i = 0; i < numVertices; ++i) {
+            formatter.appendRows(i, i + 1);
+            if (formatter.size() >= FlushThreshold) {
+                os.write(formatter.data(), formatter.size());
+                formatter.clear();
+            }
+        }
+        os.write(formatter.data(), formatter.size());
+    }
+
+    // Rows are formatted in parallel, one chunk per thread, and written in order.
+    // Chunks are sized so that one wave of buffers stays around FlushThreshold per thread.
+    void Graph::writeToFile(const std::string& path, OutputFormat format, unsigned threads) const {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Cannot open file for writing: " + path);
+        }
+
+        unsigned workers = resolveThreads(threads);
+        size_t bytesPerRow = static_cast<size_t>(std::max(numVertices, 1)) * (MaxIntChars + 1);
+        int rowsPerChunk = static_cast<int>(std::max<size_t>(1, FlushThreshold / bytesPerRow));
+        std::vector<RowFormatter> formatters(workers, RowFormatter(adjacencyMatrix, format));
+
+        for (int waveBegin = 0; waveBegin < numVertices;) {
+            int waveEnd = static_cast<int>(std::min<long long>(numVertices, waveBegin + static_cast<long long>(rowsPerChunk) * workers));
+            int waveChunks = (waveEnd - waveBegin + rowsPerChunk - 1) / rowsPerChunk;
+            parallelFor(0, waveChunks, workers, [&](unsigned, int chunkBegin, int chunkEnd) {
+                for (int chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                    int rowBegin = waveBegin + chunk * rowsPerChunk;
+                    formatters[chunk].clear();
+                    formatters[chunk].appendRows(rowBegin, std::min(waveEnd, rowBegin + rowsPerChunk));
+                }
+            });
+            for (int chunk = 0; chunk < waveChunks; ++chunk) {
+                file.write(formatters[chunk].data(), formatters[chunk].size());
+            }
+            waveBegin = waveEnd;
+        }
+
+        if (!file) {
+            throw std::runtime_error("Failed writing graph to file: " + path);
+        }
+    }
+}
@@ -1,503 +1,912 @@
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include "doctest.h"
-#include "Graph.hpp"
-#include <vector>
-#include <stdexcept>
-#include <sstream>
-using namespace ariel;
-using namespace std;
-
-TEST_SUITE("Graph Arithmetic Operators Tests") {
-    TEST_CASE("Addition of graphs") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 0, 1},
-            {0, 0, 0},
-            {1, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        Graph result = graph1 + graph2;
-        vector<vector<int>> expectedMatrix = {
-            {0, 1, 1},
-            {1, 0, 1},
-            {1, 1, 0}
-        };
-
-        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Addition assignment of graphs") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 0, 1},
-            {0, 0, 0},
-            {1, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        graph1 += graph2;
-        vector<vector<int>> expectedMatrix = {
-            {0, 1, 1},
-            {1, 0, 1},
-            {1, 1, 0}
-        };
-
-        CHECK(graph1.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Subtraction of graphs") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 0, 1},
-            {0, 0, 0},
-            {1, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        Graph result = graph1 - graph2;
-        vector<vector<int>> expectedMatrix = {
-            {0, 1, -1},
-            {1, 0, 1},
-            {-1, 1, 0}
-        };
-
-        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Subtraction assignment of graphs") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 0, 1},
-            {0, 0, 0},
-            {1, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        graph1 -= graph2;
-        vector<vector<int>> expectedMatrix = {
-            {0, 1, -1},
-            {1, 0, 1},
-            {-1, 1, 0}
-        };
-
-        CHECK(graph1.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Unary plus operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph result = +graph1;
-
-        CHECK(result.getAdjacencyMatrix() == graph1.getAdjacencyMatrix());
-    }
-
-    TEST_CASE("Unary minus operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph result = -graph1;
-        vector<vector<int>> expectedMatrix = {
-            {0, -1, 0},
-            {-1, 0, -1},
-            {0, -1, 0}
-        };
-
-        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Size mismatch exception") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1},
-            {1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK_THROWS_AS(graph1 + graph2, invalid_argument);
-        CHECK_THROWS_AS(graph1 += graph2, invalid_argument);
-        CHECK_THROWS_AS(graph1 - graph2, invalid_argument);
-        CHECK_THROWS_AS(graph1 -= graph2, invalid_argument);
-    }
-}
-
-TEST_SUITE("Graph Comparison Operators Tests") {
-    TEST_CASE("Equality operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 0},
-            {0, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK((graph1 == graph1) == true);
-        CHECK((graph1 == graph2) == false);
-    }
-
-    TEST_CASE("Inequality operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 0},
-            {0, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK((graph1 != graph2) == true);
-        CHECK((graph1 != graph1) == false);
-    }
-
-    TEST_CASE("Greater than operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 0},
-            {0, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK((graph1 > graph2) == true);
-        CHECK((graph2 > graph1) == false);
-    }
-
-    TEST_CASE("Greater than or equal operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 0},
-            {0, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK((graph1 >= graph2) == true);
-        CHECK((graph2 >= graph1) == false);
-        CHECK((graph1 >= graph1) == true);
-    }
-
-    TEST_CASE("Less than operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 0},
-            {0, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK((graph2 < graph1) == true);
-        CHECK((graph1 < graph2) == false);
-    }
-
-    TEST_CASE("Less than or equal operator") {
-        vector<vector<int>> adjMatrix1 = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {0, 1, 0},
-            {1, 0, 0},
-            {0, 0, 0}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        CHECK((graph2 <= graph1) == true);
-        CHECK((graph1 <= graph2) == false);
-        CHECK((graph1 <= graph1) == true);
-    }
-}
-
-TEST_SUITE("Graph Increment and Decrement Operators Tests") {
-    TEST_CASE("Prefix increment operator") {
-        vector<vector<int>> adjMatrix = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        Graph graph;
-        graph.loadGraph(adjMatrix);
-
-        ++graph;
-        vector<vector<int>> expectedMatrix = {
-            {1, 2, 1},
-            {2, 1, 2},
-            {1, 2, 1}
-        };
-        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Postfix increment operator") {
-        vector<vector<int>> adjMatrix = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        Graph graph;
-        graph.loadGraph(adjMatrix);
-
-        graph++;
-        vector<vector<int>> expectedMatrix = {
-            {1, 2, 1},
-            {2, 1, 2},
-            {1, 2, 1}
-        };
-        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Prefix decrement operator") {
-        vector<vector<int>> adjMatrix = {
-            {1, 2, 1},
-            {2, 1, 2},
-            {1, 2, 1}
-        };
-
-        Graph graph;
-        graph.loadGraph(adjMatrix);
-
-        --graph;
-        vector<vector<int>> expectedMatrix = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Postfix decrement operator") {
-        vector<vector<int>> adjMatrix = {
-            {1, 2, 1},
-            {2, 1, 2},
-            {1, 2, 1}
-        };
-
-        Graph graph;
-        graph.loadGraph(adjMatrix);
-
-        graph--;
-        vector<vector<int>> expectedMatrix = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
-    }
-}
-
-TEST_SUITE("Graph Multiplication Operators Tests") {
-    TEST_CASE("Scalar multiplication") {
-        vector<vector<int>> adjMatrix = {
-            {1, 2, 3},
-            {4, 5, 6},
-            {7, 8, 9}
-        };
-
-        Graph graph;
-        graph.loadGraph(adjMatrix);
-
-        Graph result = graph * 2;
-        vector<vector<int>> expectedMatrix = {
-            {2, 4, 6},
-            {8, 10, 12},
-            {14, 16, 18}
-        };
-        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
-
-        graph *= 3;
-        expectedMatrix = {
-            {3, 6, 9},
-            {12, 15, 18},
-            {21, 24, 27}
-        };
-        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
-    }
-
-    TEST_CASE("Graph multiplication") {
-        vector<vector<int>> adjMatrix1 = {
-            {1, 2},
-            {3, 4}
-        };
-
-        vector<vector<int>> adjMatrix2 = {
-            {5, 6},
-            {7, 8}
-        };
-
-        Graph graph1;
-        graph1.loadGraph(adjMatrix1);
-
-        Graph graph2;
-        graph2.loadGraph(adjMatrix2);
-
-        Graph result = graph1 * graph2;
-        vector<vector<int>> expectedMatrix = {
-            {19, 22},
-            {43, 50}
-        };
-        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
-
-        vector<vector<int>> adjMatrix3 = {
-            {1, 2, 3},
-            {4, 5, 6}
-        };
-
-        Graph graph3;
-        try
-        {
-                    graph3.loadGraph(adjMatrix3);
-
-        }
-        catch(const std::exception& e)
-        {
-            std::cout << "trying to load non square matrix should get Error: "  << '\n';
-            std::cerr << e.what() << '\n';
-        }
-        
-    
-
-        CHECK_THROWS_AS(graph1 * graph3, invalid_argument);
-    }
-}
-
-TEST_SUITE("Graph Output Operator Tests") {
-    TEST_CASE("Output operator") {
-        vector<vector<int>> adjMatrix = {
-            {0, 1, 0},
-            {1, 0, 1},
-            {0, 1, 0}
-        };
-
-        Graph graph;
-        graph.loadGraph(adjMatrix);
-
-        ostringstream os;
-        os << graph;
-
-        string expectedOutput = "Graph with 3 vertices and 2 edges (Undirected)\n"
-                                "0 1 0 \n"
-                                "1 0 1 \n"
-                                "0 1 0 \n";
-
-        CHECK(os.str() == expectedOutput);
-    }
-}
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "Graph.hpp"
+#include "CompressedGraph.hpp"
+#include <vector>
+#include <stdexcept>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <thread>
+using namespace ariel;
+using namespace std;
+
+TEST_SUITE("Graph Arithmetic Operators Tests") {
+    TEST_CASE("Addition of graphs") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 0, 1},
+            {0, 0, 0},
+            {1, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        Graph result = graph1 + graph2;
+        vector<vector<int>> expectedMatrix = {
+            {0, 1, 1},
+            {1, 0, 1},
+            {1, 1, 0}
+        };
+
+        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Addition assignment of graphs") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 0, 1},
+            {0, 0, 0},
+            {1, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        graph1 += graph2;
+        vector<vector<int>> expectedMatrix = {
+            {0, 1, 1},
+            {1, 0, 1},
+            {1, 1, 0}
+        };
+
+        CHECK(graph1.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Subtraction of graphs") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 0, 1},
+            {0, 0, 0},
+            {1, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        Graph result = graph1 - graph2;
+        vector<vector<int>> expectedMatrix = {
+            {0, 1, -1},
+            {1, 0, 1},
+            {-1, 1, 0}
+        };
+
+        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Subtraction assignment of graphs") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 0, 1},
+            {0, 0, 0},
+            {1, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        graph1 -= graph2;
+        vector<vector<int>> expectedMatrix = {
+            {0, 1, -1},
+            {1, 0, 1},
+            {-1, 1, 0}
+        };
+
+        CHECK(graph1.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Unary plus operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph result = +graph1;
+
+        CHECK(result.getAdjacencyMatrix() == graph1.getAdjacencyMatrix());
+    }
+
+    TEST_CASE("Unary minus operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph result = -graph1;
+        vector<vector<int>> expectedMatrix = {
+            {0, -1, 0},
+            {-1, 0, -1},
+            {0, -1, 0}
+        };
+
+        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Size mismatch exception") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1},
+            {1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK_THROWS_AS(graph1 + graph2, invalid_argument);
+        CHECK_THROWS_AS(graph1 += graph2, invalid_argument);
+        CHECK_THROWS_AS(graph1 - graph2, invalid_argument);
+        CHECK_THROWS_AS(graph1 -= graph2, invalid_argument);
+    }
+}
+
+TEST_SUITE("Graph Comparison Operators Tests") {
+    TEST_CASE("Equality operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK((graph1 == graph1) == true);
+        CHECK((graph1 == graph2) == false);
+    }
+
+    TEST_CASE("Inequality operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK((graph1 != graph2) == true);
+        CHECK((graph1 != graph1) == false);
+    }
+
+    TEST_CASE("Greater than operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK((graph1 > graph2) == true);
+        CHECK((graph2 > graph1) == false);
+    }
+
+    TEST_CASE("Greater than or equal operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK((graph1 >= graph2) == true);
+        CHECK((graph2 >= graph1) == false);
+        CHECK((graph1 >= graph1) == true);
+    }
+
+    TEST_CASE("Less than operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK((graph2 < graph1) == true);
+        CHECK((graph1 < graph2) == false);
+    }
+
+    TEST_CASE("Less than or equal operator") {
+        vector<vector<int>> adjMatrix1 = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        CHECK((graph2 <= graph1) == true);
+        CHECK((graph1 <= graph2) == false);
+        CHECK((graph1 <= graph1) == true);
+    }
+}
+
+TEST_SUITE("Graph Increment and Decrement Operators Tests") {
+    TEST_CASE("Prefix increment operator") {
+        vector<vector<int>> adjMatrix = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        ++graph;
+        vector<vector<int>> expectedMatrix = {
+            {1, 2, 1},
+            {2, 1, 2},
+            {1, 2, 1}
+        };
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Postfix increment operator") {
+        vector<vector<int>> adjMatrix = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        graph++;
+        vector<vector<int>> expectedMatrix = {
+            {1, 2, 1},
+            {2, 1, 2},
+            {1, 2, 1}
+        };
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Prefix decrement operator") {
+        vector<vector<int>> adjMatrix = {
+            {1, 2, 1},
+            {2, 1, 2},
+            {1, 2, 1}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        --graph;
+        vector<vector<int>> expectedMatrix = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Postfix decrement operator") {
+        vector<vector<int>> adjMatrix = {
+            {1, 2, 1},
+            {2, 1, 2},
+            {1, 2, 1}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        graph--;
+        vector<vector<int>> expectedMatrix = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
+    }
+}
+
+TEST_SUITE("Graph Multiplication Operators Tests") {
+    TEST_CASE("Scalar multiplication") {
+        vector<vector<int>> adjMatrix = {
+            {1, 2, 3},
+            {4, 5, 6},
+            {7, 8, 9}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        Graph result = graph * 2;
+        vector<vector<int>> expectedMatrix = {
+            {2, 4, 6},
+            {8, 10, 12},
+            {14, 16, 18}
+        };
+        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
+
+        graph *= 3;
+        expectedMatrix = {
+            {3, 6, 9},
+            {12, 15, 18},
+            {21, 24, 27}
+        };
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
+    }
+
+    TEST_CASE("Graph multiplication") {
+        vector<vector<int>> adjMatrix1 = {
+            {1, 2},
+            {3, 4}
+        };
+
+        vector<vector<int>> adjMatrix2 = {
+            {5, 6},
+            {7, 8}
+        };
+
+        Graph graph1;
+        graph1.loadGraph(adjMatrix1);
+
+        Graph graph2;
+        graph2.loadGraph(adjMatrix2);
+
+        Graph result = graph1 * graph2;
+        vector<vector<int>> expectedMatrix = {
+            {19, 22},
+            {43, 50}
+        };
+        CHECK(result.getAdjacencyMatrix() == expectedMatrix);
+
+        vector<vector<int>> adjMatrix3 = {
+            {1, 2, 3},
+            {4, 5, 6}
+        };
+
+        Graph graph3;
+        try
+        {
+                    graph3.loadGraph(adjMatrix3);
+
+        }
+        catch(const std::exception& e)
+        {
+            std::cout << "trying to load non square matrix should get Error: "  << '\n';
+            std::cerr << e.what() << '\n';
+        }
+        
+    
+
+        CHECK_THROWS_AS(graph1 * graph3, invalid_argument);
+    }
+}
+
+TEST_SUITE("Graph Output Operator Tests") {
+    TEST_CASE("Output operator") {
+        vector<vector<int>> adjMatrix = {
+            {0, 1, 0},
+            {1, 0, 1},
+            {0, 1, 0}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        ostringstream os;
+        os << graph;
+
+        string expectedOutput = "Graph with 3 vertices and 2 edges (Undirected)\n"
+                                "0 1 0 \n"
+                                "1 0 1 \n"
+                                "0 1 0 \n";
+
+        CHECK(os.str() == expectedOutput);
+    }
+
+    TEST_CASE("Edge list output") {
+        vector<vector<int>> adjMatrix = {
+            {0, 4, 0},
+            {0, 0, -2},
+            {7, 0, 0}
+        };
+
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        ostringstream os;
+        graph.write(os, Graph::OutputFormat::EdgeList);
+        CHECK(os.str() == "0 1 4\n1 2 -2\n2 0 7\n");
+    }
+
+    TEST_CASE("Parallel file output matches stream output") {
+        vector<vector<int>> adjMatrix(300, vector<int>(300, 0));
+        for (int i = 0; i < 300; ++i) {
+            adjMatrix[i][(i * 7 + 3) % 300] = i - 150;
+            adjMatrix[i][(i + 1) % 300] = 2147483647;
+        }
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        const char* path = "graph_write_test.txt";
+        for (Graph::OutputFormat format : {Graph::OutputFormat::Matrix, Graph::OutputFormat::EdgeList}) {
+            ostringstream expected;
+            graph.write(expected, format);
+
+            graph.writeToFile(path, format, 4);
+            ifstream file(path, ios::binary);
+            stringstream actual;
+            actual << file.rdbuf();
+            CHECK(actual.str() == expected.str());
+        }
+        remove(path);
+        CHECK_THROWS_AS(graph.writeToFile("no_such_directory/graph.txt"), runtime_error);
+    }
+}
+
+TEST_SUITE("Graph File Input Tests") {
+    void writeText(const char* path, const string& text) {
+        ofstream file(path, ios::binary);
+        file << text;
+    }
+
+    TEST_CASE("Loading a matrix file") {
+        const char* path = "graph_read_test.txt";
+        writeText(path, "0 2\t0 6\r\n\n 2 0 3 0\n0 3 0 1\n6 0 1 0");
+
+        Graph graph;
+        graph.loadFromFile(path);
+        vector<vector<int>> expectedMatrix = {
+            {0, 2, 0, 6},
+            {2, 0, 3, 0},
+            {0, 3, 0, 1},
+            {6, 0, 1, 0}
+        };
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix);
+        CHECK(graph.getNumVertices() == 4);
+        CHECK(graph.getNumEdges() == 4);
+
+        ostringstream os;
+        os << graph;
+        CHECK(os.str().rfind("Graph with 4 vertices and 4 edges (Undirected)\n", 0) == 0);
+
+        writeText(path, "0 1\n1 0 1\n");
+        CHECK_THROWS_AS(graph.loadFromFile(path), invalid_argument);
+        writeText(path, "0 x\n1 0\n");
+        CHECK_THROWS_AS(graph.loadFromFile(path), invalid_argument);
+        CHECK(graph.getAdjacencyMatrix() == expectedMatrix); // unchanged after a failed load
+        remove(path);
+        CHECK_THROWS_AS(graph.loadFromFile("no_such_file.txt"), runtime_error);
+    }
+
+    TEST_CASE("Parallel load matches loadGraph") {
+        vector<vector<int>> adjMatrix(400, vector<int>(400, 0));
+        for (int i = 0; i < 400; ++i) {
+            adjMatrix[i][(i * 13 + 5) % 400] = i % 7 - 3;
+            adjMatrix[(i * 13 + 5) % 400][i] = i % 7 - 3;
+        }
+        Graph expected;
+        expected.loadGraph(adjMatrix);
+
+        const char* path = "graph_read_test.txt";
+        for (int asymmetricRow : {-1, 399}) {
+            if (asymmetricRow >= 0) {
+                adjMatrix[asymmetricRow][0] += 100;
+                expected.loadGraph(adjMatrix);
+            }
+            expected.writeToFile(path);
+            Graph graph;
+            graph.loadFromFile(path, 4);
+            CHECK(graph == expected);
+            CHECK(graph.getNumEdges() == expected.getNumEdges());
+            ostringstream actualText, expectedText;
+            actualText << graph;
+            expectedText << expected;
+            CHECK(actualText.str() == expectedText.str());
+        }
+        remove(path);
+    }
+}
+
+TEST_SUITE("Graph Reordering Tests") {
+    // Path 0-3-1-4-2 with scrambled labels
+    vector<vector<int>> scrambledPath = {
+        {0, 0, 0, 1, 0},
+        {0, 0, 0, 1, 1},
+        {0, 0, 0, 0, 1},
+        {1, 1, 0, 0, 0},
+        {0, 1, 1, 0, 0}
+    };
+
+    bool isPermutation(const VertexOrdering& ordering, int n) {
+        if ((int)ordering.permutation.size() != n || (int)ordering.inverse.size() != n) return false;
+        for (int i = 0; i < n; ++i) {
+            if (ordering.inverse[ordering.permutation[i]] != i) return false;
+        }
+        return true;
+    }
+
+    TEST_CASE("Reverse Cuthill-McKee reduces bandwidth") {
+        Graph graph;
+        graph.loadGraph(scrambledPath);
+        CHECK(graph.getBandwidth() == 3);
+
+        VertexOrdering ordering = graph.reverseCuthillMcKee();
+        CHECK(isPermutation(ordering, 5));
+
+        Graph result = graph.reordered(ordering);
+        CHECK(result.getBandwidth() == 1);
+        CHECK(result.getNumEdges() == graph.getNumEdges());
+        for (int u = 0; u < 5; ++u) {
+            for (int v = 0; v < 5; ++v) {
+                CHECK(result.getAdjacencyMatrix()[ordering.inverse[u]][ordering.inverse[v]] == scrambledPath[u][v]);
+            }
+        }
+    }
+
+    TEST_CASE("Degree and Gorder orderings") {
+        vector<vector<int>> star = {
+            {0, 0, 0, 1},
+            {0, 0, 0, 1},
+            {0, 0, 0, 1},
+            {1, 1, 1, 0}
+        };
+        Graph graph;
+        graph.loadGraph(star);
+
+        VertexOrdering byDegree = graph.degreeOrdering();
+        CHECK(byDegree.permutation == vector<int>({3, 0, 1, 2}));
+        CHECK(isPermutation(byDegree, 4));
+
+        // Two interleaved triangles {0, 2, 4} and {1, 3, 5}
+        vector<vector<int>> triangles = {
+            {0, 0, 1, 0, 1, 0},
+            {0, 0, 0, 1, 0, 1},
+            {1, 0, 0, 0, 1, 0},
+            {0, 1, 0, 0, 0, 1},
+            {1, 0, 1, 0, 0, 0},
+            {0, 1, 0, 1, 0, 0}
+        };
+        graph.loadGraph(triangles);
+        VertexOrdering gorder = graph.gorderOrdering(2);
+        CHECK(isPermutation(gorder, 6));
+        for (int i = 0; i < 3; ++i) {
+            CHECK(gorder.permutation[i] % 2 == gorder.permutation[0] % 2); // triangles stay contiguous
+        }
+        CHECK_THROWS_AS(graph.gorderOrdering(0), invalid_argument);
+
+        VertexOrdering wrongSize = byDegree;
+        CHECK_THROWS_AS(graph.reordered(wrongSize), invalid_argument);
+    }
+}
+
+TEST_SUITE("Compressed Graph Tests") {
+    vector<pair<int, int>> neighborsOf(const CompressedGraph& compressed, int v) {
+        vector<pair<int, int>> result;
+        compressed.forEachNeighbor(v, [&](int to, int weight) { result.push_back({to, weight}); });
+        return result;
+    }
+
+    TEST_CASE("Compressed rows decode to the matrix rows") {
+        // Row 0 mixes an interval (2..7) with residuals, row 2 is weighted
+        vector<vector<int>> adjMatrix = {
+            {0, 1, 1, 1, 1, 1, 1, 1, 0, 1},
+            {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {5, 0, 0, -3, 0, 0, 0, 0, 0, 7},
+            {0, 1, 1, 1, 1, 1, 0, 1, 1, 1},
+            {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {0, 0, 0, 0, 0, 0, 0, 0, 0, 1},
+            {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+            {1, 1, 1, 1, 1, 1, 1, 1, 1, 0}
+        };
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+        CompressedGraph compressed(graph);
+
+        CHECK(compressed.getNumVertices() == 10);
+        long long arcs = 0;
+        for (int u = 0; u < 10; ++u) {
+            vector<pair<int, int>> expected;
+            for (int v = 0; v < 10; ++v) {
+                if (adjMatrix[u][v] != 0) expected.push_back({v, adjMatrix[u][v]});
+            }
+            CHECK(neighborsOf(compressed, u) == expected);
+            CHECK(compressed.getDegree(u) == (int)expected.size());
+            arcs += expected.size();
+        }
+        CHECK(compressed.getNumArcs() == arcs);
+    }
+
+    TEST_CASE("Builder streams sorted edges") {
+        CompressedGraph::Builder builder(4);
+        builder.addEdge(0, 1);
+        builder.addEdge(0, 3, 4);
+        builder.addEdge(2, 0);
+        CHECK_THROWS_AS(builder.addEdge(1, 0), invalid_argument);
+        CHECK_THROWS_AS(builder.addEdge(2, 0), invalid_argument);
+        CHECK_THROWS_AS(builder.addEdge(2, 4), out_of_range);
+        builder.addEdge(3, 2, -1);
+        CompressedGraph compressed = builder.build();
+
+        CHECK(neighborsOf(compressed, 0) == vector<pair<int, int>>({{1, 1}, {3, 4}}));
+        CHECK(neighborsOf(compressed, 1).empty());
+        CHECK(neighborsOf(compressed, 2) == vector<pair<int, int>>({{0, 1}}));
+        CHECK(neighborsOf(compressed, 3) == vector<pair<int, int>>({{2, -1}}));
+        CHECK(compressed.getNumArcs() == 4);
+    }
+}
+
+TEST_SUITE("Graph Cached View Tests") {
+    TEST_CASE("Adjacency list and weight flag follow modifications") {
+        vector<vector<int>> adjMatrix = {
+            {0, 2, 0},
+            {0, 0, 3},
+            {1, 0, 0}
+        };
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        const AdjacencyList& list = graph.getAdjacencyList();
+        CHECK(list.offsets == vector<int>({0, 1, 2, 3}));
+        CHECK(list.targets == vector<int>({1, 2, 0}));
+        CHECK(list.weights == vector<int>({2, 3, 1}));
+        CHECK(graph.hasNegativeWeights() == false);
+
+        Graph copy = graph;
+        graph *= -1;
+        CHECK(graph.hasNegativeWeights() == true);
+        CHECK(graph.getAdjacencyList().weights == vector<int>({-2, -3, -1}));
+        CHECK(copy.hasNegativeWeights() == false);
+        CHECK(copy.getAdjacencyList().weights == vector<int>({2, 3, 1}));
+
+        ++graph;
+        CHECK(graph.getAdjacencyList().targets.size() == 8); // zeros became 1, the -1 entry became 0
+    }
+
+    TEST_CASE("Copies can be taken while readers fill the cache") {
+        vector<vector<int>> ring(64, vector<int>(64, 0));
+        for (int i = 0; i < 64; ++i) {
+            ring[i][(i + 1) % 64] = i + 1;
+        }
+        Graph graph;
+        graph.loadGraph(ring);
+
+        std::thread reader([&graph]() {
+            for (int i = 0; i < 200; ++i) {
+                graph.getAdjacencyList();
+                graph.hasNegativeWeights();
+            }
+        });
+        Graph copy;
+        for (int i = 0; i < 200; ++i) {
+            Graph taken(graph);
+            copy = graph;
+            CHECK(taken.getVersion() == graph.getVersion());
+        }
+        reader.join();
+        CHECK(copy.getAdjacencyList().targets.size() == 64);
+        CHECK(copy.getAdjacencyList().weights[63] == 64);
+    }
+
+    TEST_CASE("Directedness follows the matrix") {
+        vector<vector<int>> symmetric = {
+            {0, 2},
+            {2, 0}
+        };
+        Graph graph;
+        graph.loadGraph(symmetric);
+        CHECK(graph.isDirectedGraph() == false);
+        Graph product = graph * graph;
+        CHECK(product.isDirectedGraph() == false);
+
+        vector<vector<int>> asymmetric = {
+            {0, 1},
+            {3, 0}
+        };
+        Graph other;
+        other.loadGraph(asymmetric);
+        CHECK(other.isDirectedGraph() == true);
+        graph += other;
+        CHECK(graph.isDirectedGraph() == true);
+    }
+
+    TEST_CASE("Single edges can be added and removed") {
+        vector<vector<int>> adjMatrix = {
+            {0, 1, 0},
+            {1, 0, 0},
+            {0, 0, 0}
+        };
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+        unsigned long long version = graph.getVersion();
+        CHECK(graph.getNumEdges() == 1);
+
+        graph.addEdge(1, 2, 4);
+        CHECK(graph.getVersion() != version);
+        CHECK(graph.getNumEdges() == 3); // the graph became directed
+        graph.addEdge(2, 1, 4);
+        CHECK(graph.getNumEdges() == 2); // mirroring (1, 2) makes it undirected again
+        CHECK(graph.getAdjacencyList().targets == vector<int>({1, 0, 2, 1}));
+        CHECK(graph.isDirectedGraph() == false);
+        graph.addEdge(1, 2, -3);
+        CHECK(graph.hasNegativeWeights() == true);
+        CHECK(graph.isDirectedGraph() == true);
+
+        CHECK(graph.removeEdge(0, 2) == false);
+        CHECK(graph.removeEdge(1, 2) == true);
+        CHECK(graph.getNumEdges() == 3);
+        CHECK(graph.removeEdge(2, 1) == true);
+        CHECK(graph.getNumEdges() == 1);
+        CHECK(graph.getAdjacencyMatrix()[2] == vector<int>({0, 0, 0}));
+        CHECK(graph.hasNegativeWeights() == false);
+
+        CHECK_THROWS_AS(graph.addEdge(0, 3), std::out_of_range);
+        CHECK_THROWS_AS(graph.addEdge(0, 2, 0), std::invalid_argument);
+        CHECK_THROWS_AS(graph.removeEdge(-1, 0), std::out_of_range);
+    }
+
+    TEST_CASE("Edits report the edge count and direction of a fresh load") {
+        vector<vector<int>> adjMatrix = {
+            {0, 1, 0},
+            {0, 0, 0},
+            {0, 2, 5}
+        };
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+        auto header = [](const Graph& g) {
+            ostringstream out;
+            out << g;
+            return out.str().substr(0, out.str().find('\n'));
+        };
+        auto matchesFreshLoad = [&header](const Graph& g) {
+            Graph fresh;
+            fresh.loadGraph(g.getAdjacencyMatrix());
+            return g.getNumEdges() == fresh.getNumEdges() && g.isDirectedGraph() == fresh.isDirectedGraph() &&
+                   header(g) == header(fresh);
+        };
+
+        graph.addEdge(1, 0);
+        CHECK(matchesFreshLoad(graph));
+        graph.addEdge(1, 2, 2);
+        CHECK(graph.getNumEdges() == 2);
+        CHECK(header(graph).find("(Undirected)") != string::npos);
+        CHECK(matchesFreshLoad(graph));
+        graph.addEdge(2, 1, 7);
+        CHECK(matchesFreshLoad(graph));
+        graph.removeEdge(2, 2);
+        graph.removeEdge(0, 1);
+        CHECK(matchesFreshLoad(graph));
+        graph.addEdge(0, 1, 1);
+        graph.addEdge(2, 1, 2);
+        CHECK(matchesFreshLoad(graph));
+        CHECK(graph.isDirectedGraph() == false);
+
+        // Operators leave the counts to be rebuilt by the next edit
+        graph *= 3;
+        graph.addEdge(0, 2, 4);
+        CHECK(matchesFreshLoad(graph));
+        graph.addEdge(2, 0, 4);
+        CHECK(matchesFreshLoad(graph));
+    }
+
+    TEST_CASE("Reverse adjacency list lists incoming edges") {
+        vector<vector<int>> adjMatrix = {
+            {0, 2, 4},
+            {0, 0, 3},
+            {1, 0, 0}
+        };
+        Graph graph;
+        graph.loadGraph(adjMatrix);
+
+        const AdjacencyList& reverse = graph.getReverseAdjacencyList();
+        CHECK(reverse.offsets == vector<int>({0, 1, 2, 4}));
+        CHECK(reverse.targets == vector<int>({2, 0, 0, 1}));
+        CHECK(reverse.weights == vector<int>({1, 2, 4, 3}));
+
+        graph *= 2;
+        CHECK(graph.getReverseAdjacencyList().weights == vector<int>({2, 4, 8, 6}));
+    }
+}
@@ -0,0 +1,224 @@
+#include "Algorithms.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace ariel {
+    namespace {
+        // Highest-label push-relabel over a row-major residual matrix. Phase one
+        // discharges only vertices below height n, which yields a maximum preflow:
+        // the sink's excess is the flow value. Phase two relabels the remaining
+        // vertices by their residual distance to the source and returns their excess
+        // there, turning the preflow into a flow.
+        class PushRelabel {
+        public:
+            PushRelabel(const Graph &g, int source, int sink)
+                : n(g.getNumVertices()), source(source), sink(sink), limit(n), highest(-1), relabels(0),
+                  residual(static_cast<size_t>(n) * n), excess(n, 0), height(n, 0), current(n, 0),
+                  count(2 * n + 1, 0), buckets(2 * n + 1), queue(n) {
+                const std::vector<std::vector<int>> &adjacencyMatrix = g.getAdjacencyMatrix();
+                for (int u = 0; u < n; ++u) {
+                    for (int v = 0; v < n; ++v) {
+                        if (adjacencyMatrix[u][v] < 0) {
+                            throw std::invalid_argument("Capacities must be non-negative.");
+                        }
+                        residual[static_cast<size_t>(u) * n + v] = u == v ? 0 : adjacencyMatrix[u][v];
+                    }
+                }
+            }
+
+            long long run() {
+                height[source] = n;
+                long long *row = &residual[static_cast<size_t>(source) * n];
+                for (int v = 0; v < n; ++v) {
+                    if (row[v] > 0) {
+                        excess[source] += row[v];
+                        push(source, v);
+                    }
+                }
+                globalRelabel();
+                discharging(false);
+
+                returnExcess();
+                discharging(true);
+                return excess[sink];
+            }
+
+            // Net flow on each pair, clamped at zero, and the vertices that cannot reach
+            // the sink through residual edges
+            void fill(const Graph &g, FlowResult &result) const {
+                const std::vector<std::vector<int>> &adjacencyMatrix = g.getAdjacencyMatrix();
+                result.flows.assign(static_cast<size_t>(n) * n, 0);
+                for (int u = 0; u < n; ++u) {
+                    for (int v = 0; v < n; ++v) {
+                        long long net = (u == v ? 0 : adjacencyMatrix[u][v]) - residual[static_cast<size_t>(u) * n + v];
+                        if (net > 0) result.flows[static_cast<size_t>(u) * n + v] = net;
+                    }
+                }
+                std::vector<int> distance;
+                reverseDistances(sink, distance);
+                result.sourceSide.assign(n, false);
+                for (int v = 0; v < n; ++v) {
+                    result.sourceSide[v] = distance[v] == -1;
+                }
+            }
+
+        private:
+            void push(int u, int v) {
+                long long &forward = residual[static_cast<size_t>(u) * n + v];
+                long long delta = std::min(excess[u], forward);
+                forward -= delta;
+                residual[static_cast<size_t>(v) * n + u] += delta;
+                excess[u] -= delta;
+                if (excess[v] == 0 && v != source && v != sink) activate(v);
+                excess[v] += delta;
+            }
+
+            void activate(int v) {
+                if (height[v] < limit) {
+                    buckets[height[v]].push_back(v);
+                    highest = std::max(highest, height[v]);
+                }
+            }
+
+            // Breadth-first distances to target along residual edges, -1 where target is
+            // unreachable. The scan reads a column per vertex, which costs O(V²) like a
+            // single sweep of the matrix.
+            void reverseDistances(int target, std::vector<int> &distance) const {
+                distance.assign(n, -1);
+                distance[target] = 0;
+                int head = 0;
+                int tail = 0;
+                queue[tail++] = target;
+                while (head < tail) {
+                    int v = queue[head++];
+                    for (int u = 0; u < n; ++u) {
+                        if (distance[u] == -1 && residual[static_cast<size_t>(u) * n + v] > 0) {
+                            distance[u] = distance[v] + 1;
+                            queue[tail++] = u;
+                        }
+                    }
+                }
+            }
+
+            // Exact heights from residual distances to the sink; vertices that cannot
+            // reach it leave phase one at height n
+            void globalRelabel() {
+                std::vector<int> distance;
+                reverseDistances(sink, distance);
+                for (int v = 0; v < n; ++v) {
+                    if (v != source) height[v] = distance[v] == -1 ? n : distance[v];
+                }
+                rebuild();
+            }
+
+            // Phase two heights: n plus the residual distance to the source for every
+            // vertex that cannot reach the sink. No residual edge leaves that set, so
+            // its excess goes back to the source without touching the rest.
+            void returnExcess() {
+                limit = 2 * n;
+                std::vector<int> toSink;
+                std::vector<int> toSource;
+                reverseDistances(sink, toSink);
+                reverseDistances(source, toSource);
+                for (int v = 0; v < n; ++v) {
+                    if (toSink[v] == -1) height[v] = toSource[v] == -1 ? 2 * n : n + toSource[v];
+                }
+                rebuild();
+            }
+
+            void rebuild() {
+                std::fill(count.begin(), count.end(), 0);
+                std::fill(current.begin(), current.end(), 0);
+                for (std::vector<int> &bucket : buckets) bucket.clear();
+                highest = -1;
+                relabels = 0;
+                for (int v = 0; v < n; ++v) {
+                    ++count[height[v]];
+                    if (excess[v] > 0 && v != source && v != sink) activate(v);
+                }
+            }
+
+            // Once no vertex is left at height from, none at or above it can reach the sink
+            void gap(int from) {
+                for (int v = 0; v < n; ++v) {
+                    if (height[v] >= from && height[v] < n) {
+                        --count[height[v]];
+                        height[v] = n;
+                        ++count[n];
+                    }
+                }
+            }
+
+            void discharging(bool returning) {
+                while (true) {
+                    while (highest >= 0 && buckets[highest].empty()) --highest;
+                    if (highest < 0) break;
+                    int u = buckets[highest].back();
+                    buckets[highest].pop_back();
+                    if (height[u] != highest || excess[u] == 0) continue;
+                    discharge(u, returning);
+                    if (!returning && relabels >= n) globalRelabel();
+                }
+            }
+
+            void discharge(int u, bool returning) {
+                long long *row = &residual[static_cast<size_t>(u) * n];
+                while (excess[u] > 0) {
+                    int v = current[u];
+                    for (; v < n; ++v) {
+                        if (row[v] > 0 && height[u] == height[v] + 1) {
+                            push(u, v);
+                            if (excess[u] == 0) break;
+                        }
+                    }
+                    current[u] = v;
+                    if (excess[u] == 0) return;
+
+                    int old = height[u];
+                    if (!returning && count[old] == 1) {
+                        gap(old);
+                        return;
+                    }
+                    int lowest = 2 * n - 1;
+                    for (int w = 0; w < n; ++w) {
+                        if (row[w] > 0) lowest = std::min(lowest, height[w]);
+                    }
+                    --count[old];
+                    height[u] = lowest + 1;
+                    ++count[height[u]];
+                    current[u] = 0;
+                    ++relabels;
+                    if (height[u] >= limit) return;
+                }
+            }
+
+            int n;
+            int source;
+            int sink;
+            int limit;     // heights at or above it are not discharged in the current phase
+            int highest;   // highest bucket that may be non-empty
+            int relabels;  // since the last global relabel
+            std::vector<long long> residual;
+            std::vector<long long> excess;
+            std::vector<int> height;
+            std::vector<int> current;             // next column to scan in each row
+            std::vector<int> count;               // vertices per height
+            std::vector<std::vector<int>> buckets; // active vertices per height
+            mutable std::vector<int> queue;
+        };
+    }
+
+    void Algorithms::maximumFlow(const Graph &g, int source, int sink, FlowResult &result) {
+        int numVertices = g.getNumVertices();
+        if (source < 0 || source >= numVertices || sink < 0 || sink >= numVertices) {
+            throw std::out_of_range("Vertex index out of range.");
+        }
+        if (source == sink) {
+            throw std::invalid_argument("Source and sink must differ.");
+        }
+        PushRelabel solver(g, source, sink);
+        result.numVertices = numVertices;
+        result.value = solver.run();
+        solver.fill(g, result);
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace ariel {
+    // Number of worker threads to use; 0 means one per hardware thread
+    inline unsigned resolveThreads(unsigned requested) {
+        if (requested != 0) return requested;
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+    // Splits [begin, end) into one contiguous slice per thread and runs
+    // body(thread, sliceBegin, sliceEnd) on each; the caller runs slice 0.
+    // The body must not throw.
+    template <typename Body>
+    void parallelFor(int begin, int end, unsigned threads, Body body) {
+        int count = end - begin;
+        if (count <= 0) return;
+        int slices = std::min<int>(resolveThreads(threads), count);
+        if (slices <= 1) {
+            body(0u, begin, end);
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(slices - 1);
+        for (int t = 1; t < slices; ++t) {
+            int sliceBegin = begin + static_cast<int>(static_cast<long long>(count) * t / slices);
+            int sliceEnd = begin + static_cast<int>(static_cast<long long>(count) * (t + 1) / slices);
+            workers.emplace_back(body, static_cast<unsigned>(t), sliceBegin, sliceEnd);
+        }
+        body(0u, begin, begin + static_cast<int>(count / slices));
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Lock-free union-find over an array of parent links: a root is its own parent,
+    // and linking hooks the larger root under the smaller with a CAS, so any number
+    // of threads may link at once. compressComponents points every vertex straight
+    // at its root; call it only while no thread is linking.
+    inline int findComponentRoot(std::vector<std::atomic<int>>& parent, int v) {
+        int p = parent[v].load(std::memory_order_relaxed);
+        while (p != v) {
+            v = p;
+            p = parent[v].load(std::memory_order_relaxed);
+        }
+        return v;
+    }
+
+    inline void linkComponents(std::vector<std::atomic<int>>& parent, int u, int v) {
+        int a = parent[u].load(std::memory_order_relaxed);
+        int b = parent[v].load(std::memory_order_relaxed);
+        while (a != b) {
+            int high = std::max(a, b);
+            int low = std::min(a, b);
+            int highParent = parent[high].load(std::memory_order_relaxed);
+            if (highParent == low) break;
+            if (highParent == high && parent[high].compare_exchange_strong(highParent, low, std::memory_order_relaxed)) break;
+            a = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            b = parent[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    inline void compressComponents(std::vector<std::atomic<int>>& parent, unsigned threads) {
+        parallelFor(0, static_cast<int>(parent.size()), threads, [&](unsigned, int begin, int end) {
+            for (int v = begin; v < end; ++v) {
+                int p = parent[v].load(std::memory_order_relaxed);
+                while (p != parent[p].load(std::memory_order_relaxed)) {
+                    p = parent[p].load(std::memory_order_relaxed);
+                }
+                parent[v].store(p, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    // Reusable barrier for a fixed group of threads
+    class Barrier {
+    public:
+        explicit Barrier(unsigned count) : count(count), waiting(0), generation(0) {}
+
+        void wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            unsigned long long arrived = generation;
+            if (++waiting == count) {
+                waiting = 0;
+                ++generation;
+                condition.notify_all();
+                return;
+            }
+            condition.wait(lock, [&] { return generation != arrived; });
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        unsigned count;
+        unsigned waiting;
+        unsigned long long generation;
+    };
+}
+
+#endif
@@ -0,0 +1,221 @@
+#include "Reachability.hpp"
+#include "Algorithms.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <stdexcept>
+
+namespace ariel {
+    namespace {
+        const size_t ParallelWords = 1 << 14; // words of rows per level worth splitting across threads
+
+        // Condensed DAG in CSR form with duplicate arcs removed. Tarjan numbers the
+        // components sinks first, so every arc goes from a larger id to a smaller one.
+        int condense(const Graph& g, std::vector<int>& component, std::vector<int>& offsets, std::vector<int>& targets) {
+            int count = Algorithms::stronglyConnectedComponents(g, component);
+            const AdjacencyList& list = g.getAdjacencyList();
+            std::vector<std::pair<int, int>> arcs;
+            for (int u = 0; u < g.getNumVertices(); ++u) {
+                for (int k = list.offsets[u]; k < list.offsets[u + 1]; ++k) {
+                    int from = component[u];
+                    int to = component[list.targets[k]];
+                    if (from != to) arcs.emplace_back(from, to);
+                }
+            }
+            std::sort(arcs.begin(), arcs.end());
+            arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+            offsets.assign(count + 1, 0);
+            targets.resize(arcs.size());
+            for (size_t i = 0; i < arcs.size(); ++i) {
+                ++offsets[arcs[i].first + 1];
+                targets[i] = arcs[i].second;
+            }
+            for (int c = 0; c < count; ++c) {
+                offsets[c + 1] += offsets[c];
+            }
+            return count;
+        }
+
+        void checkVertices(int numVertices, int from, int to) {
+            if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+                throw std::out_of_range("Vertex index out of range.");
+            }
+        }
+
+        // Per-thread marks for GRAIL's pruned searches; a mark is current when it
+        // equals stamp, so clearing is a single increment
+        struct SearchScratch {
+            std::vector<unsigned> mark;
+            unsigned stamp = 0;
+            std::vector<int> stack;
+        };
+        thread_local SearchScratch searchScratch;
+    }
+
+    TransitiveClosure::TransitiveClosure(const Graph& g, unsigned threads) : numVertices(g.getNumVertices()) {
+        std::vector<int> offsets;
+        std::vector<int> targets;
+        numComponents = condense(g, component, offsets, targets);
+        words = (static_cast<size_t>(numComponents) + 63) / 64;
+        rows.assign(words * numComponents, 0);
+
+        // Height above the sinks; a row only needs the rows of lower components
+        std::vector<int> height(numComponents, 0);
+        int maxHeight = 0;
+        for (int c = 0; c < numComponents; ++c) {
+            for (int k = offsets[c]; k < offsets[c + 1]; ++k) {
+                height[c] = std::max(height[c], height[targets[k]] + 1);
+            }
+            maxHeight = std::max(maxHeight, height[c]);
+        }
+        std::vector<int> levelStart(maxHeight + 2, 0);
+        for (int c = 0; c < numComponents; ++c) ++levelStart[height[c] + 1];
+        for (int h = 0; h <= maxHeight; ++h) levelStart[h + 1] += levelStart[h];
+        std::vector<int> byLevel(numComponents);
+        std::vector<int> next(levelStart.begin(), levelStart.end() - 1);
+        for (int c = 0; c < numComponents; ++c) byLevel[next[height[c]]++] = c;
+
+        // Successors are visited from the largest id down: larger ids sit higher in
+        // the DAG, so their rows often already cover the smaller ones, which are skipped
+        auto fillRow = [&](int c) {
+            uint64_t* row = rows.data() + c * words;
+            row[c / 64] |= uint64_t(1) << (c % 64);
+            for (int k = offsets[c + 1] - 1; k >= offsets[c]; --k) {
+                int s = targets[k];
+                if (row[s / 64] >> (s % 64) & 1) continue;
+                const uint64_t* successor = rows.data() + s * words;
+                for (size_t w = 0; w < words; ++w) row[w] |= successor[w];
+            }
+        };
+        unsigned workers = resolveThreads(threads);
+        for (int h = 0; h <= maxHeight; ++h) {
+            int size = levelStart[h + 1] - levelStart[h];
+            unsigned levelThreads = static_cast<size_t>(size) * words >= ParallelWords ? workers : 1;
+            parallelFor(levelStart[h], levelStart[h + 1], levelThreads, [&](unsigned, int begin, int end) {
+                for (int i = begin; i < end; ++i) fillRow(byLevel[i]);
+            });
+        }
+    }
+
+    bool TransitiveClosure::reaches(int from, int to) const {
+        checkVertices(numVertices, from, to);
+        int target = component[to];
+        return rows[component[from] * words + target / 64] >> (target % 64) & 1;
+    }
+
+    int TransitiveClosure::getNumComponents() const {
+        return numComponents;
+    }
+
+    size_t TransitiveClosure::getSizeInBytes() const {
+        return rows.size() * sizeof(uint64_t) + component.size() * sizeof(int);
+    }
+
+    // Each pass shuffles the roots and every successor list, then labels components
+    // in post-order: rank is the finishing position and low the smallest rank in
+    // the component's subtree or below any of its successors
+    GrailIndex::GrailIndex(const Graph& g, int traversals, unsigned seed) : numVertices(g.getNumVertices()), traversals(traversals) {
+        if (traversals < 1) {
+            throw std::invalid_argument("GRAIL needs at least one traversal.");
+        }
+        numComponents = condense(g, component, offsets, targets);
+        low.resize(static_cast<size_t>(traversals) * numComponents);
+        rank.resize(static_cast<size_t>(traversals) * numComponents);
+
+        std::vector<bool> hasParent(numComponents, false);
+        for (int target : targets) hasParent[target] = true;
+        std::vector<int> roots;
+        for (int c = 0; c < numComponents; ++c) {
+            if (!hasParent[c]) roots.push_back(c);
+        }
+
+        std::mt19937 random(seed);
+        std::vector<int> shuffled;
+        std::vector<int> position(numComponents);
+        std::vector<bool> visited;
+        std::vector<int> stack;
+        for (int k = 0; k < traversals; ++k) {
+            shuffled = targets;
+            for (int c = 0; c < numComponents; ++c) {
+                std::shuffle(shuffled.begin() + offsets[c], shuffled.begin() + offsets[c + 1], random);
+            }
+            std::shuffle(roots.begin(), roots.end(), random);
+            int* passLow = low.data() + static_cast<size_t>(k) * numComponents;
+            int* passRank = rank.data() + static_cast<size_t>(k) * numComponents;
+            visited.assign(numComponents, false);
+            int finished = 0;
+            for (int root : roots) {
+                visited[root] = true;
+                passLow[root] = INT_MAX;
+                position[root] = offsets[root];
+                stack.push_back(root);
+                while (!stack.empty()) {
+                    int c = stack.back();
+                    if (position[c] < offsets[c + 1]) {
+                        int w = shuffled[position[c]++];
+                        if (!visited[w]) {
+                            visited[w] = true;
+                            passLow[w] = INT_MAX;
+                            position[w] = offsets[w];
+                            stack.push_back(w);
+                        } else {
+                            passLow[c] = std::min(passLow[c], passLow[w]); // finished, as the graph is acyclic
+                        }
+                        continue;
+                    }
+                    passRank[c] = ++finished;
+                    passLow[c] = std::min(passLow[c], passRank[c]);
+                    stack.pop_back();
+                    if (!stack.empty()) {
+                        passLow[stack.back()] = std::min(passLow[stack.back()], passLow[c]);
+                    }
+                }
+            }
+        }
+    }
+
+    bool GrailIndex::contains(int outer, int inner) const {
+        for (int k = 0; k < traversals; ++k) {
+            size_t base = static_cast<size_t>(k) * numComponents;
+            if (low[base + inner] < low[base + outer] || rank[base + inner] > rank[base + outer]) return false;
+        }
+        return true;
+    }
+
+    // Arcs only lead to smaller component ids, so components below the target's id
+    // are skipped along with those whose labels exclude it
+    bool GrailIndex::reaches(int from, int to) const {
+        checkVertices(numVertices, from, to);
+        int source = component[from];
+        int target = component[to];
+        if (source == target) return true;
+        if (source < target || !contains(source, target)) return false;
+
+        SearchScratch& scratch = searchScratch;
+        if (scratch.mark.size() < static_cast<size_t>(numComponents) || ++scratch.stamp == 0) {
+            scratch.mark.assign(std::max<size_t>(scratch.mark.size(), numComponents), 0);
+            scratch.stamp = 1;
+        }
+        scratch.stack.clear();
+        scratch.stack.push_back(source);
+        scratch.mark[source] = scratch.stamp;
+        while (!scratch.stack.empty()) {
+            int c = scratch.stack.back();
+            scratch.stack.pop_back();
+            for (int k = offsets[c]; k < offsets[c + 1]; ++k) {
+                int w = targets[k];
+                if (w == target) return true;
+                if (w > target && scratch.mark[w] != scratch.stamp && contains(w, target)) {
+                    scratch.mark[w] = scratch.stamp;
+                    scratch.stack.push_back(w);
+                }
+            }
+        }
+        return false;
+    }
+
+    int GrailIndex::getNumComponents() const {
+        return numComponents;
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef REACHABILITY_HPP
+#define REACHABILITY_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Graph.hpp"
+
+namespace ariel {
+    // Both indexes work on the condensation of the graph: strongly connected
+    // components become single nodes, so vertices in one component share their
+    // answers and the remaining graph is a DAG. Every vertex reaches itself.
+    // Indexes are snapshots; rebuild them after modifying the graph.
+
+    // Full transitive closure as one bit row per component. reaches() is a single
+    // bit test. Rows are filled sinks first, each as the word-wide OR of its
+    // successors' rows, and components at the same height are filled in parallel.
+    // Memory is components² / 8 bytes.
+    class TransitiveClosure {
+    public:
+        explicit TransitiveClosure(const Graph& g, unsigned threads = 0);
+
+        bool reaches(int from, int to) const;
+        int getNumComponents() const;
+        size_t getSizeInBytes() const;
+
+    private:
+        int numVertices;
+        int numComponents;
+        size_t words;                 // 64-bit words per row
+        std::vector<int> component;   // component of each vertex
+        std::vector<uint64_t> rows;   // rows[c * words ...]: components reachable from c
+    };
+
+    // GRAIL interval labels (Yildirim et al.) for graphs too large for a closure.
+    // Each of `traversals` randomized post-order DFS passes gives every component
+    // an interval that contains the intervals of everything it reaches, so a
+    // missing containment proves unreachability in O(traversals). Otherwise a DFS
+    // runs, pruned to components whose labels still contain the target. Space
+    // is linear in the size of the condensation.
+    class GrailIndex {
+    public:
+        explicit GrailIndex(const Graph& g, int traversals = 3, unsigned seed = 1);
+
+        bool reaches(int from, int to) const;
+        int getNumComponents() const;
+
+    private:
+        bool contains(int outer, int inner) const;
+
+        int numVertices;
+        int numComponents;
+        int traversals;
+        std::vector<int> component;
+        std::vector<int> offsets;   // condensed DAG, row c occupies [offsets[c], offsets[c + 1])
+        std::vector<int> targets;
+        std::vector<int> low;       // low[k * numComponents + c], interval [low, rank] of pass k
+        std::vector<int> rank;
+    };
+}
+
+#endif
@@ -0,0 +1,170 @@
+#include "Algorithms.hpp"
+#include "Parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+
+namespace ariel {
+    namespace {
+        const uint64_t NoEdge = UINT64_MAX;
+
+        void requireUndirected(const Graph &g) {
+            if (g.isDirectedGraph()) {
+                throw std::invalid_argument("Spanning trees need an undirected graph.");
+            }
+        }
+
+        // Orders candidate edges by weight, then by index, so that every weight is
+        // distinct in effect and the cheapest edges of all components form no cycle
+        uint64_t edgeKey(int weight, size_t index) {
+            return static_cast<uint64_t>(static_cast<uint32_t>(weight) ^ 0x80000000u) << 32 | index;
+        }
+
+        void atomicMin(std::atomic<uint64_t> &target, uint64_t value) {
+            uint64_t current = target.load(std::memory_order_relaxed);
+            while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        void finish(SpanningForest &forest) {
+            std::sort(forest.edges.begin(), forest.edges.end(), [](const SpanningEdge &a, const SpanningEdge &b) {
+                return a.from != b.from ? a.from < b.from : a.to < b.to;
+            });
+            forest.totalWeight = 0;
+            for (const SpanningEdge &e : forest.edges) {
+                forest.totalWeight += e.weight;
+            }
+        }
+    }
+
+    void Algorithms::minimumSpanningForest(const Graph &g, SpanningForest &forest, unsigned threads) {
+        long long numVertices = g.getNumVertices();
+        if (static_cast<long long>(g.getAdjacencyList().targets.size()) * 8 < numVertices * numVertices) {
+            boruvkaSpanningForest(g, forest, threads);
+        } else {
+            primSpanningForest(g, forest);
+        }
+    }
+
+    // O(V²) Prim with an array of keys, which matches the cost of reading the matrix.
+    // When no remaining vertex has a finite key, the smallest one starts a new tree.
+    void Algorithms::primSpanningForest(const Graph &g, SpanningForest &forest) {
+        requireUndirected(g);
+        const std::vector<std::vector<int>> &adjacencyMatrix = g.getAdjacencyMatrix();
+        int numVertices = g.getNumVertices();
+        forest.edges.clear();
+        forest.trees = 0;
+
+        std::vector<long long> key(numVertices, LLONG_MAX);
+        std::vector<int> parent(numVertices, -1);
+        std::vector<bool> inTree(numVertices, false);
+        for (int added = 0; added < numVertices; ++added) {
+            int u = -1;
+            for (int v = 0; v < numVertices; ++v) {
+                if (!inTree[v] && (u == -1 || key[v] < key[u])) u = v;
+            }
+            inTree[u] = true;
+            if (parent[u] == -1) {
+                ++forest.trees;
+            } else {
+                forest.edges.push_back({std::min(parent[u], u), std::max(parent[u], u), adjacencyMatrix[parent[u]][u]});
+            }
+            const std::vector<int> &row = adjacencyMatrix[u];
+            for (int v = 0; v < numVertices; ++v) {
+                if (row[v] != 0 && !inTree[v] && row[v] < key[v]) {
+                    key[v] = row[v];
+                    parent[v] = u;
+                }
+            }
+        }
+        finish(forest);
+    }
+
+    // Boruvka rounds over the edge list of the CSR view. Each round, every
+    // component finds its cheapest outgoing edge with an atomic minimum, then the
+    // chosen edges are linked in parallel through the lock-free union-find (an edge
+    // chosen from both ends is kept by the smaller root only). Edges inside one
+    // component are dropped before the next round, and the rounds end when none
+    // are left, so disconnected graphs give one tree per component.
+    void Algorithms::boruvkaSpanningForest(const Graph &g, SpanningForest &forest, unsigned threads) {
+        requireUndirected(g);
+        int numVertices = g.getNumVertices();
+        unsigned workers = resolveThreads(threads);
+        const AdjacencyList &list = g.getAdjacencyList();
+        forest.edges.clear();
+
+        std::vector<SpanningEdge> edges;
+        for (int u = 0; u < numVertices; ++u) {
+            for (int k = list.offsets[u]; k < list.offsets[u + 1]; ++k) {
+                if (u < list.targets[k]) edges.push_back({u, list.targets[k], list.weights[k]});
+            }
+        }
+
+        std::vector<std::atomic<int>> parent(numVertices);
+        std::vector<std::atomic<uint64_t>> cheapest(numVertices);
+        std::vector<int> root(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            parent[v].store(v, std::memory_order_relaxed);
+            root[v] = v;
+        }
+        std::vector<std::vector<SpanningEdge>> chosen(workers);
+        std::vector<size_t> kept(workers + 1);
+        std::vector<SpanningEdge> remaining;
+
+        while (!edges.empty()) {
+            parallelFor(0, numVertices, workers, [&](unsigned, int begin, int end) {
+                for (int v = begin; v < end; ++v) cheapest[v].store(NoEdge, std::memory_order_relaxed);
+            });
+            parallelFor(0, static_cast<int>(edges.size()), workers, [&](unsigned, int begin, int end) {
+                for (int i = begin; i < end; ++i) {
+                    uint64_t key = edgeKey(edges[i].weight, i);
+                    atomicMin(cheapest[root[edges[i].from]], key);
+                    atomicMin(cheapest[root[edges[i].to]], key);
+                }
+            });
+            parallelFor(0, numVertices, workers, [&](unsigned thread, int begin, int end) {
+                for (int r = begin; r < end; ++r) {
+                    uint64_t key = cheapest[r].load(std::memory_order_relaxed);
+                    if (root[r] != r || key == NoEdge) continue;
+                    const SpanningEdge &e = edges[key & 0xffffffffu];
+                    int other = root[e.from] == r ? root[e.to] : root[e.from];
+                    if (other < r && cheapest[other].load(std::memory_order_relaxed) == key) continue;
+                    chosen[thread].push_back(e);
+                    linkComponents(parent, e.from, e.to);
+                }
+            });
+            compressComponents(parent, workers);
+
+            // Keep the edges that still join two components, in their current order
+            parallelFor(0, static_cast<int>(edges.size()), workers, [&](unsigned thread, int begin, int end) {
+                kept[thread + 1] = 0;
+                for (int i = begin; i < end; ++i) {
+                    kept[thread + 1] += parent[edges[i].from].load(std::memory_order_relaxed) != parent[edges[i].to].load(std::memory_order_relaxed);
+                }
+            });
+            int slices = std::min<size_t>(workers, edges.size());
+            for (int t = 0; t < slices; ++t) kept[t + 1] += kept[t];
+            remaining.resize(kept[slices]);
+            parallelFor(0, static_cast<int>(edges.size()), workers, [&](unsigned thread, int begin, int end) {
+                size_t at = kept[thread];
+                for (int i = begin; i < end; ++i) {
+                    if (parent[edges[i].from].load(std::memory_order_relaxed) != parent[edges[i].to].load(std::memory_order_relaxed)) {
+                        remaining[at++] = edges[i];
+                    }
+                }
+            });
+            edges.swap(remaining);
+            parallelFor(0, numVertices, workers, [&](unsigned, int begin, int end) {
+                for (int v = begin; v < end; ++v) root[v] = parent[v].load(std::memory_order_relaxed);
+            });
+        }
+
+        for (const std::vector<SpanningEdge> &picked : chosen) {
+            forest.edges.insert(forest.edges.end(), picked.begin(), picked.end());
+        }
+        forest.trees = numVertices - static_cast<int>(forest.edges.size());
+        finish(forest);
+    }
+}
@@ -1,376 +1,1734 @@
-#include "Graph.hpp"
-#include "Algorithms.hpp"
-using ariel::Algorithms;
-#include <iostream>
-#include <stdexcept>
-#include <cassert>
-#include <vector>
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include "doctest.h"
-using namespace std;
-
-TEST_SUITE("isConnected tests") {
-    ariel::Graph g;
-
-    TEST_CASE("Testing the isConnected function Undirected") {
-        cout << "Starting tests" << endl;
-        cout << "testing isconnected()" << endl;
-
-        // Undirected unweighted graph (connected)
-        vector<vector<int>> undirectedUnweighted = {
-                {0, 1, 0, 0},
-                {1, 0, 1, 0},
-                {0, 1, 0, 1},
-                {0, 0, 1, 0}
-        };
-        g.loadGraph(undirectedUnweighted);
-        g.printGraph();
-        CHECK(ariel::Algorithms::isConnected(g) == true); // Expect true
-    }
-
-    TEST_CASE("Testing the isConnected function undirected") {
-        // Undirected weighted graph (connected)
-        vector<vector<int>> undirectedWeighted = {
-                {0, 2, 0, 6},
-                {2, 0, 3, 0},
-                {0, 3, 0, 1},
-                {6, 0, 1, 0}
-        };
-        g.loadGraph(undirectedWeighted);
-        g.printGraph();
-        CHECK(ariel::Algorithms::isConnected(g) == true);  // Expect true
-    }
-
-    TEST_CASE("Testing the isConnected function Directed cyclic") {
-        // Directed unweighted graph (cyclic)
-        vector<vector<int>> directedUnweighted = {
-                {0, 1, 0, 0},
-                {0, 0, 1, 0},
-                {0, 0, 0, 1},
-                {1, 0, 0, 0}
-        };
-        g.loadGraph(directedUnweighted);
-        g.printGraph();
-        CHECK(ariel::Algorithms::isConnected(g) == true); // Expect true
-    }
-
-    TEST_CASE("Testing the isConnected function Directed cyclic") {
-        // Directed weighted graph (cyclic)
-        vector<vector<int>> directedWeighted = {
-                {0, 4, 0, 0},
-                {0, 0, 5, 0},
-                {0, 0, 0, 2},
-                {1, 0, 0, 0}
-        };
-        g.loadGraph(directedWeighted);
-        g.printGraph();
-        CHECK(ariel::Algorithms::isConnected(g) == true); // Expect true
-    }
-
-    TEST_CASE("Testing the isConnected function on Disconnected Undirected") {
-        // Disconnected graphs
-        // Undirected unweighted disconnected graph
-        vector<vector<int>> undirectedUnweightedDisconnected = {
-                {0, 1, 0, 0},
-                {1, 0, 0, 0},
-                {0, 0, 0, 1},
-                {0, 0, 1, 0}
-        };
-        g.loadGraph(undirectedUnweightedDisconnected);
-        g.printGraph();
-        CHECK(ariel::Algorithms::isConnected(g) == false); // Expect false
-    }
-}
-
-TEST_SUITE("shortestPath tests") {
-    ariel::Graph graph;
-
-    TEST_CASE("Testing the shortestPath1 function") {
-        // Directed unweighted graph (cyclic)
-        vector<vector<int>> directedUnweightedShortest = {
-                {0, 1, 0, 0},
-                {0, 0, 1, 0},
-                {0, 0, 0, 1},
-                {1, 0, 0, 0}
-        };
-        graph.loadGraph(directedUnweightedShortest);
-        graph.printGraph();
-        string shortestPath3 = Algorithms::shortestPath(graph, 0, 3);
-        CHECK(shortestPath3 == "0->1->2->3");
-        cout << "Shortest path from 0 to 3: " << shortestPath3 << endl;
-    }
-
-TEST_CASE("Testing the shortestPath2 function") {
-
-    // Undirected unweighted graph (connected)
-    vector<vector<int>> undirectedUnweighted1 = {
-        {0, 1, 0, 0},
-        {1, 0, 1, 0},
-        {0, 1, 0, 1},
-        {0, 0, 1, 0}
-    };
-    graph.loadGraph(undirectedUnweighted1);
-    graph.printGraph();
-    CHECK(Algorithms::shortestPath(graph, 0, 3)=="0->1->2->3");// Should print: "0 -> 1 -> 2 -> 3"
-
-
-}
-
-TEST_CASE("Testing the shortestPath3 function") {
-    // Undirected weighted graph (connected)
-    vector<vector<int>> undirectedWeightedShortest = {
-        {0, 2, 0, 6},
-        {2, 0, 2, 0},
-        {0, 3, 0, 1},
-        {6, 0, 1, 0}
-    };
-    graph.loadGraph(undirectedWeightedShortest);
-    graph.printGraph();   
-    CHECK(Algorithms::shortestPath(graph, 0, 2) == "0->1->2");
-
-}
-
-
-TEST_CASE("Testing the shortestPath4 function") {
-    // Directed weighted graph (cyclic)
-    vector<vector<int>> directedWeightedShortest = {
-        {0, 4, 0, 0},
-        {0, 0, 5, 0},
-        {0, 0, 0, 2},
-        {1, 0, 0, 0}
-    };
-    graph.loadGraph(directedWeightedShortest);
-    graph.printGraph();
-    string shortestPath4 = Algorithms::shortestPath(graph, 0, 3);
-    CHECK(shortestPath4 == "0->1->2->3");
-
-}
-}
-
-
-
-TEST_SUITE("iscontainscycle tests") {
-    ariel::Graph g;
-
-
-TEST_CASE("Testing the iscontainscycle function") {
-
-    // Undirected unweighted graph (connected)
-    vector<vector<int>> undirectedUnweightedCycle = {
-        {0, 1, 0, 0},
-        {1, 0, 1, 0},
-        {0, 1, 0, 1},
-        {0, 0, 1, 0}
-    };
-    g.loadGraph(undirectedUnweightedCycle);
-    g.printGraph();
-    CHECK(Algorithms::isContainsCycle(g) == "0");  // Expect false
-}
-
-TEST_CASE("Testing the iscontainscycle function") {
-
-    // Undirected weighted graph (connected)
-    vector<vector<int>> undirectedWeightedCycle = {
-        {0, 2, 0, 6},
-        {2, 0, 3, 0},
-        {0, 3, 0, 1},
-        {6, 0, 1, 0}
-    };
-    g.loadGraph(undirectedWeightedCycle);
-    g.printGraph();
-    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->3->0");  // Expect false
-
-}
-
-TEST_CASE("Testing the iscontainscycle function") {
-  // Directed unweighted graph (cyclic)
-    vector<vector<int>> directedUnweightedCycle = {
-        {0, 1, 0, 0},
-        {0, 0, 1, 0},
-        {0, 0, 0, 1},
-        {1, 0, 0, 0}
-    };
-    g.loadGraph(directedUnweightedCycle);
-    g.printGraph();
-
-    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->3->0");  // Expect true
-
-}
-
-TEST_CASE("Testing the iscontainscycle function") {
-        // Directed weighted graph (cyclic)
-    vector<vector<int>> directedWeightedCycle = {
-        {0, 4, 0, 0},
-        {0, 0, 5, 0},
-        {0, 0, 0, 2},
-        {1, 0, 0, 0}
-    };
-    g.loadGraph(directedWeightedCycle);
-    g.printGraph();
-    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->3->0");  // Expect true
-
-}
-
-TEST_CASE("Testing the iscontainscycle function") {
-        // Disconnected graphs
-    // Undirected unweighted disconnected graph
-    vector<vector<int>> undirectedUnweightedDisconnectedCycle = {
-        {0, 1, 0, 0},
-        {1, 0, 0, 0},
-        {0, 0, 0, 1},
-        {0, 0, 1, 0}
-    };
-    g.loadGraph(undirectedUnweightedDisconnectedCycle);
-    g.printGraph();
-    assert(Algorithms::isContainsCycle(g) == "0");  // Expect false
-
-}
-}
-
-TEST_SUITE("negativecycle tests") {
-
-    ariel::Graph g;
-
-
-TEST_CASE("Testing the negativecycle1 function") {
-    // Undirected unweighted graph (connected)
-    vector<vector<int>> undirectedUnweightedNegative = {
-        {0, 1, 0, 0},
-        {1, 0, 1, 0},
-        {0, 1, 0, 1},
-        {0, 0, 1, 0}
-    };
-    g.loadGraph(undirectedUnweightedNegative);
-    g.printGraph();
-    cout << Algorithms::negativeCycle(g) << endl;
-    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
-}
-TEST_CASE("Testing the negativecycle2 function") {
-        // Undirected weighted graph (connected)
-    vector<vector<int>> undirectedWeightedNegative = {
-        {0, 2, 0, 6},
-        {2, 0, 3, 0},
-        {0, 3, 0, 1},
-        {6, 0, 1, 0}
-    };
-
-    g.loadGraph(undirectedWeightedNegative);
-    g.printGraph();
-    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
-
-}
-TEST_CASE("Testing the negativecycle3 function") {
-        // Directed unweighted graph (cyclic)
-    vector<vector<int>> directedUnweightedNegative = {
-        {0, 1, 0, 0},
-        {0, 0, 1, 0},
-        {0, 0, 0, 1},
-        {1, 0, 0, 0}
-    };
-    g.loadGraph(directedUnweightedNegative);
-    g.printGraph();
-    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
-
-}
-TEST_CASE("Testing the negativecycle4 function") {
-        // Directed weighted graph (cyclic)
-    vector<vector<int>> directedWeightedNegative = {
-        {0, -4, 0, 0},
-        {0, 0, 5, 0},
-        {0, 0, 0, -2},
-        {-1, 0, 0, 0}
-    };
-
-    g.loadGraph(directedWeightedNegative);
-    g.printGraph();
-    cout << Algorithms::negativeCycle(g) << endl;
-    CHECK(Algorithms::negativeCycle(g) == "0->1->2->3->0");  // Expect false
-
-}
-
-TEST_CASE("Testing the negativecycle5 function") {
-    // Disconnected graphs
-    // Undirected unweighted disconnected graph
-    vector<vector<int>> undirectedUnweightedDisconnectedNegative = {
-        {0, 1, 0, 0},
-        {1, 0, 0, 0},
-        {0, 0, 0, 1},
-        {0, 0, 1, 0}
-    };
-    g.loadGraph(undirectedUnweightedDisconnectedNegative);
-
-    g.printGraph();
-    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
-
-}
-
-
-}
-
-
-
-
-TEST_SUITE("isbipartite tests") {
-
-    ariel::Graph g;
-
-TEST_CASE("Testing the isbipartite1 function") {
-    // Undirected unweighted graph (connected)
-    vector<vector<int>> undirectedUnweightedBipartite = {
-        {0, 1, 0, 0},
-        {1, 0, 1, 0},
-        {0, 1, 0, 1},
-        {0, 0, 1, 0}
-    };
-    g.loadGraph(undirectedUnweightedBipartite);
-    g.printGraph();
-    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2}, B={1, 3}.");
-
-}
-TEST_CASE("Testing the isbipartite2 function") {
-        // Undirected weighted graph (connected)
-    vector<vector<int>> treeBipartite = {
-        {0, 1, 0, 0, 0},
-        {1, 0, 1, 1, 0},
-        {0, 1, 0, 0, 0},
-        {0, 1, 0, 0, 1},
-        {0, 0, 0, 1, 0}
-    };
-    g.loadGraph(treeBipartite);
-    g.printGraph();
-    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2, 3}, B={1, 4}.");  // Expect true because it's bipartite
-
-}
-TEST_CASE("Testing the isbipartite3 function") {
-        vector<vector<int>> noddCycleGraph = {
-        {0, 1, 0, 0, 0},
-        {1, 0, 1, 0, 0},
-        {0, 1, 0, 1, 0},
-        {0, 0, 1, 0, 1},
-        {0, 0, 0, 1, 0}
-    };
-    g.loadGraph(noddCycleGraph);
-    g.printGraph();
-    cout << "Is Bipartite: " << Algorithms::isBipartite(g) << endl; 
-
-    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2, 4}, B={1, 3}.");  
-
-}
-TEST_CASE("Testing the isbipartite4 function") {
-        vector<vector<int>> oddCycleGraph = {
-        {0, 1, 0},
-        {0, 0, 1},
-        {1, 0, 0}
-    };
-    g.loadGraph(oddCycleGraph);
-    g.printGraph();
-    cout << " " << Algorithms::isBipartite(g) << endl; 
-
-    CHECK(Algorithms::isBipartite(g) == "The graph is not bipartite.");  // Expect false because it's not bipartite
-
-}
-
-}
-
-
-
+#include "Graph.hpp"
+#include "Algorithms.hpp"
+#include "DynamicConnectivity.hpp"
+#include "DynamicShortestPaths.hpp"
+#include "Reachability.hpp"
+using ariel::Algorithms;
+#include <iostream>
+#include <stdexcept>
+#include <cassert>
+#include <vector>
+#include <climits>
+#include <thread>
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+using namespace std;
+
+TEST_SUITE("isConnected tests") {
+    ariel::Graph g;
+
+    TEST_CASE("Testing the isConnected function Undirected") {
+        cout << "Starting tests" << endl;
+        cout << "testing isconnected()" << endl;
+
+        // Undirected unweighted graph (connected)
+        vector<vector<int>> undirectedUnweighted = {
+                {0, 1, 0, 0},
+                {1, 0, 1, 0},
+                {0, 1, 0, 1},
+                {0, 0, 1, 0}
+        };
+        g.loadGraph(undirectedUnweighted);
+        g.printGraph();
+        CHECK(ariel::Algorithms::isConnected(g) == true); // Expect true
+    }
+
+    TEST_CASE("Testing the isConnected function undirected") {
+        // Undirected weighted graph (connected)
+        vector<vector<int>> undirectedWeighted = {
+                {0, 2, 0, 6},
+                {2, 0, 3, 0},
+                {0, 3, 0, 1},
+                {6, 0, 1, 0}
+        };
+        g.loadGraph(undirectedWeighted);
+        g.printGraph();
+        CHECK(ariel::Algorithms::isConnected(g) == true);  // Expect true
+    }
+
+    TEST_CASE("Testing the isConnected function Directed cyclic") {
+        // Directed unweighted graph (cyclic)
+        vector<vector<int>> directedUnweighted = {
+                {0, 1, 0, 0},
+                {0, 0, 1, 0},
+                {0, 0, 0, 1},
+                {1, 0, 0, 0}
+        };
+        g.loadGraph(directedUnweighted);
+        g.printGraph();
+        CHECK(ariel::Algorithms::isConnected(g) == true); // Expect true
+    }
+
+    TEST_CASE("Testing the isConnected function Directed cyclic") {
+        // Directed weighted graph (cyclic)
+        vector<vector<int>> directedWeighted = {
+                {0, 4, 0, 0},
+                {0, 0, 5, 0},
+                {0, 0, 0, 2},
+                {1, 0, 0, 0}
+        };
+        g.loadGraph(directedWeighted);
+        g.printGraph();
+        CHECK(ariel::Algorithms::isConnected(g) == true); // Expect true
+    }
+
+    TEST_CASE("Testing the isConnected function on Disconnected Undirected") {
+        // Disconnected graphs
+        // Undirected unweighted disconnected graph
+        vector<vector<int>> undirectedUnweightedDisconnected = {
+                {0, 1, 0, 0},
+                {1, 0, 0, 0},
+                {0, 0, 0, 1},
+                {0, 0, 1, 0}
+        };
+        g.loadGraph(undirectedUnweightedDisconnected);
+        g.printGraph();
+        CHECK(ariel::Algorithms::isConnected(g) == false); // Expect false
+    }
+}
+
+TEST_SUITE("shortestPath tests") {
+    ariel::Graph graph;
+
+    TEST_CASE("Testing the shortestPath1 function") {
+        // Directed unweighted graph (cyclic)
+        vector<vector<int>> directedUnweightedShortest = {
+                {0, 1, 0, 0},
+                {0, 0, 1, 0},
+                {0, 0, 0, 1},
+                {1, 0, 0, 0}
+        };
+        graph.loadGraph(directedUnweightedShortest);
+        graph.printGraph();
+        string shortestPath3 = Algorithms::shortestPath(graph, 0, 3);
+        CHECK(shortestPath3 == "0->1->2->3");
+        cout << "Shortest path from 0 to 3: " << shortestPath3 << endl;
+    }
+
+TEST_CASE("Testing the shortestPath2 function") {
+
+    // Undirected unweighted graph (connected)
+    vector<vector<int>> undirectedUnweighted1 = {
+        {0, 1, 0, 0},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {0, 0, 1, 0}
+    };
+    graph.loadGraph(undirectedUnweighted1);
+    graph.printGraph();
+    CHECK(Algorithms::shortestPath(graph, 0, 3)=="0->1->2->3");// Should print: "0 -> 1 -> 2 -> 3"
+
+
+}
+
+TEST_CASE("Testing the shortestPath3 function") {
+    // Undirected weighted graph (connected)
+    vector<vector<int>> undirectedWeightedShortest = {
+        {0, 2, 0, 6},
+        {2, 0, 2, 0},
+        {0, 3, 0, 1},
+        {6, 0, 1, 0}
+    };
+    graph.loadGraph(undirectedWeightedShortest);
+    graph.printGraph();   
+    CHECK(Algorithms::shortestPath(graph, 0, 2) == "0->1->2");
+
+}
+
+
+TEST_CASE("Testing the shortestPath4 function") {
+    // Directed weighted graph (cyclic)
+    vector<vector<int>> directedWeightedShortest = {
+        {0, 4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, 2},
+        {1, 0, 0, 0}
+    };
+    graph.loadGraph(directedWeightedShortest);
+    graph.printGraph();
+    string shortestPath4 = Algorithms::shortestPath(graph, 0, 3);
+    CHECK(shortestPath4 == "0->1->2->3");
+
+}
+
+TEST_CASE("Testing shortestPath with negative weights") {
+    vector<vector<int>> negativeShortcut = {
+        {0, 4, 3},
+        {0, 0, -2},
+        {0, 0, 0}
+    };
+    graph.loadGraph(negativeShortcut);
+    CHECK(Algorithms::shortestPath(graph, 0, 2) == "0->1->2");
+    CHECK(Algorithms::shortestPath(graph, 2, 0) == "-1");
+
+    vector<vector<int>> negativeCycle = {
+        {0, 1, 0},
+        {0, 0, -3},
+        {0, 1, 0}
+    };
+    graph.loadGraph(negativeCycle);
+    CHECK(Algorithms::shortestPath(graph, 0, 2) == "Graph contains a negative weight cycle");
+
+    // A negative undirected edge can be walked back and forth, so it is a negative cycle
+    vector<vector<int>> negativeUndirected = {
+        {0, -1, 0},
+        {-1, 0, 2},
+        {0, 2, 0}
+    };
+    graph.loadGraph(negativeUndirected);
+    CHECK(Algorithms::shortestPath(graph, 0, 2) == "Graph contains a negative weight cycle");
+}
+
+TEST_CASE("Testing the Dijkstra paths of shortestPath") {
+    // Sparse ring with a weighted chord: served by the heap over the CSR view
+    vector<vector<int>> ring(40, vector<int>(40, 0));
+    for (int i = 0; i < 40; ++i) {
+        ring[i][(i + 1) % 40] = 1;
+    }
+    ring[0][30] = 25;
+    graph.loadGraph(ring);
+    CHECK(Algorithms::shortestPath(graph, 0, 31) == "0->30->31");
+    CHECK(Algorithms::shortestPath(graph, 0, 3) == "0->1->2->3");
+    CHECK(Algorithms::shortestPath(graph, 5, 5) == "5");
+
+    // Dense complete graph: served by the O(V^2) array scan
+    vector<vector<int>> complete(6, vector<int>(6, 10));
+    for (int i = 0; i < 6; ++i) {
+        complete[i][i] = 0;
+        if (i + 1 < 6) complete[i][i + 1] = 1;
+    }
+    graph.loadGraph(complete);
+    CHECK(Algorithms::shortestPath(graph, 0, 5) == "0->1->2->3->4->5");
+    CHECK(Algorithms::shortestPath(graph, 5, 4) == "5->4");
+    CHECK_THROWS_AS(Algorithms::shortestPath(graph, 0, 6), std::out_of_range);
+}
+}
+
+
+
+TEST_SUITE("iscontainscycle tests") {
+    ariel::Graph g;
+
+
+TEST_CASE("Testing the iscontainscycle function") {
+
+    // Undirected unweighted graph (connected)
+    vector<vector<int>> undirectedUnweightedCycle = {
+        {0, 1, 0, 0},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {0, 0, 1, 0}
+    };
+    g.loadGraph(undirectedUnweightedCycle);
+    g.printGraph();
+    CHECK(Algorithms::isContainsCycle(g) == "0");  // Expect false
+}
+
+TEST_CASE("Testing the iscontainscycle function") {
+
+    // Undirected weighted graph (connected)
+    vector<vector<int>> undirectedWeightedCycle = {
+        {0, 2, 0, 6},
+        {2, 0, 3, 0},
+        {0, 3, 0, 1},
+        {6, 0, 1, 0}
+    };
+    g.loadGraph(undirectedWeightedCycle);
+    g.printGraph();
+    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->3->0");  // Expect false
+
+}
+
+TEST_CASE("Testing the iscontainscycle function") {
+  // Directed unweighted graph (cyclic)
+    vector<vector<int>> directedUnweightedCycle = {
+        {0, 1, 0, 0},
+        {0, 0, 1, 0},
+        {0, 0, 0, 1},
+        {1, 0, 0, 0}
+    };
+    g.loadGraph(directedUnweightedCycle);
+    g.printGraph();
+
+    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->3->0");  // Expect true
+
+}
+
+TEST_CASE("Testing the iscontainscycle function") {
+        // Directed weighted graph (cyclic)
+    vector<vector<int>> directedWeightedCycle = {
+        {0, 4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, 2},
+        {1, 0, 0, 0}
+    };
+    g.loadGraph(directedWeightedCycle);
+    g.printGraph();
+    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->3->0");  // Expect true
+
+}
+
+TEST_CASE("Testing the iscontainscycle function") {
+        // Disconnected graphs
+    // Undirected unweighted disconnected graph
+    vector<vector<int>> undirectedUnweightedDisconnectedCycle = {
+        {0, 1, 0, 0},
+        {1, 0, 0, 0},
+        {0, 0, 0, 1},
+        {0, 0, 1, 0}
+    };
+    g.loadGraph(undirectedUnweightedDisconnectedCycle);
+    g.printGraph();
+    assert(Algorithms::isContainsCycle(g) == "0");  // Expect false
+
+}
+}
+
+TEST_SUITE("iterative cycle tests") {
+
+TEST_CASE("Testing directed cycle detection uses back edges only") {
+    // 0->1, 0->2, 2->1 has a cross edge but no cycle
+    vector<vector<int>> crossEdge = {
+        {0, 1, 1},
+        {0, 0, 0},
+        {0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(crossEdge);
+    vector<int> cycle;
+    CHECK(Algorithms::isContainsCycle(g, cycle) == false);
+    CHECK(Algorithms::isContainsCycle(g) == "0");
+
+    // Two opposite arcs with different weights are a directed 2-cycle
+    vector<vector<int>> twoCycle = {
+        {0, 1, 0},
+        {2, 0, 0},
+        {0, 0, 0}
+    };
+    g.loadGraph(twoCycle);
+    CHECK(Algorithms::isContainsCycle(g) == "0->1->0");
+
+    vector<vector<int>> selfLoop = {
+        {0, 0},
+        {0, 3}
+    };
+    g.loadGraph(selfLoop);
+    CHECK(Algorithms::isContainsCycle(g, cycle) == true);
+    CHECK(cycle == vector<int>({1}));
+}
+
+TEST_CASE("Testing cycle detection on long paths") {
+    const int n = 2500;
+    vector<vector<int>> path(n, vector<int>(n, 0));
+    for (int v = 0; v + 1 < n; ++v) {
+        path[v][v + 1] = path[v + 1][v] = 1;
+    }
+    ariel::Graph g;
+    g.loadGraph(path);
+    vector<int> cycle;
+    CHECK(Algorithms::isContainsCycle(g, cycle) == false);
+
+    path[0][n - 1] = path[n - 1][0] = 1;
+    g.loadGraph(path);
+    CHECK(Algorithms::isContainsCycle(g, cycle) == true);
+    CHECK(cycle.size() == static_cast<size_t>(n));
+    CHECK(cycle.front() == 0);
+    CHECK(cycle[1] == 1);
+
+    // Directed version, where the edge back to the predecessor does count
+    for (int v = 0; v + 1 < n; ++v) {
+        path[v + 1][v] = 0;
+    }
+    path[n - 1][0] = 0;
+    g.loadGraph(path);
+    CHECK(Algorithms::isContainsCycle(g, cycle) == false);
+    path[n - 1][n - 2] = 1;
+    g.loadGraph(path);
+    CHECK(Algorithms::isContainsCycle(g) == "2498->2499->2498");
+}
+
+}
+
+TEST_SUITE("negativecycle tests") {
+
+    ariel::Graph g;
+
+
+TEST_CASE("Testing the negativecycle1 function") {
+    // Undirected unweighted graph (connected)
+    vector<vector<int>> undirectedUnweightedNegative = {
+        {0, 1, 0, 0},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {0, 0, 1, 0}
+    };
+    g.loadGraph(undirectedUnweightedNegative);
+    g.printGraph();
+    cout << Algorithms::negativeCycle(g) << endl;
+    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
+}
+TEST_CASE("Testing the negativecycle2 function") {
+        // Undirected weighted graph (connected)
+    vector<vector<int>> undirectedWeightedNegative = {
+        {0, 2, 0, 6},
+        {2, 0, 3, 0},
+        {0, 3, 0, 1},
+        {6, 0, 1, 0}
+    };
+
+    g.loadGraph(undirectedWeightedNegative);
+    g.printGraph();
+    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
+
+}
+TEST_CASE("Testing the negativecycle3 function") {
+        // Directed unweighted graph (cyclic)
+    vector<vector<int>> directedUnweightedNegative = {
+        {0, 1, 0, 0},
+        {0, 0, 1, 0},
+        {0, 0, 0, 1},
+        {1, 0, 0, 0}
+    };
+    g.loadGraph(directedUnweightedNegative);
+    g.printGraph();
+    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
+
+}
+TEST_CASE("Testing the negativecycle4 function") {
+        // Directed weighted graph (cyclic)
+    vector<vector<int>> directedWeightedNegative = {
+        {0, -4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, -2},
+        {-1, 0, 0, 0}
+    };
+
+    g.loadGraph(directedWeightedNegative);
+    g.printGraph();
+    cout << Algorithms::negativeCycle(g) << endl;
+    CHECK(Algorithms::negativeCycle(g) == "0->1->2->3->0");  // Expect false
+
+}
+
+TEST_CASE("Testing the negativecycle5 function") {
+    // Disconnected graphs
+    // Undirected unweighted disconnected graph
+    vector<vector<int>> undirectedUnweightedDisconnectedNegative = {
+        {0, 1, 0, 0},
+        {1, 0, 0, 0},
+        {0, 0, 0, 1},
+        {0, 0, 1, 0}
+    };
+    g.loadGraph(undirectedUnweightedDisconnectedNegative);
+
+    g.printGraph();
+    CHECK(Algorithms::negativeCycle(g) == "0");  // Expect false
+
+}
+
+TEST_CASE("Testing negativeCycle away from vertex 0") {
+    vector<vector<int>> unreachableCycle = {
+        {0, 0, 0, 0, 0},
+        {0, 0, 2, 0, 0},
+        {0, 0, 0, -4, 0},
+        {0, 1, 0, 0, 0},
+        {0, 0, 0, 0, 0}
+    };
+    g.loadGraph(unreachableCycle);
+    CHECK(Algorithms::negativeCycle(g) == "1->2->3->1");
+    CHECK(Algorithms::shortestPath(g, 0, 3) == "-1");
+    CHECK(Algorithms::shortestPath(g, 1, 3) == "Graph contains a negative weight cycle");
+
+    vector<vector<int>> undirectedNegativeEdge = {
+        {0, 3, 0},
+        {3, 0, -1},
+        {0, -1, 0}
+    };
+    g.loadGraph(undirectedNegativeEdge);
+    CHECK(Algorithms::negativeCycle(g) == "1->2->1");
+}
+
+TEST_CASE("Testing negativeCycle on a larger arbitrage-style graph") {
+    // Complete graph with positive weights and one negative 3-cycle 40->17->63->40
+    vector<vector<int>> rates(80, vector<int>(80, 0));
+    for (int i = 0; i < 80; ++i) {
+        for (int j = 0; j < 80; ++j) {
+            if (i != j) rates[i][j] = 5 + (i * 7 + j * 3) % 11;
+        }
+    }
+    rates[40][17] = -4;
+    rates[17][63] = -4;
+    rates[63][40] = 2;
+    g.loadGraph(rates);
+    CHECK(Algorithms::negativeCycle(g) == "17->63->40->17");
+
+    rates[63][40] = 9;
+    g.loadGraph(rates);
+    CHECK(Algorithms::negativeCycle(g) == "0");
+}
+
+
+}
+
+
+
+
+TEST_SUITE("isbipartite tests") {
+
+    ariel::Graph g;
+
+TEST_CASE("Testing the isbipartite1 function") {
+    // Undirected unweighted graph (connected)
+    vector<vector<int>> undirectedUnweightedBipartite = {
+        {0, 1, 0, 0},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {0, 0, 1, 0}
+    };
+    g.loadGraph(undirectedUnweightedBipartite);
+    g.printGraph();
+    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2}, B={1, 3}.");
+
+}
+TEST_CASE("Testing the isbipartite2 function") {
+        // Undirected weighted graph (connected)
+    vector<vector<int>> treeBipartite = {
+        {0, 1, 0, 0, 0},
+        {1, 0, 1, 1, 0},
+        {0, 1, 0, 0, 0},
+        {0, 1, 0, 0, 1},
+        {0, 0, 0, 1, 0}
+    };
+    g.loadGraph(treeBipartite);
+    g.printGraph();
+    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2, 3}, B={1, 4}.");  // Expect true because it's bipartite
+
+}
+TEST_CASE("Testing the isbipartite3 function") {
+        vector<vector<int>> noddCycleGraph = {
+        {0, 1, 0, 0, 0},
+        {1, 0, 1, 0, 0},
+        {0, 1, 0, 1, 0},
+        {0, 0, 1, 0, 1},
+        {0, 0, 0, 1, 0}
+    };
+    g.loadGraph(noddCycleGraph);
+    g.printGraph();
+    cout << "Is Bipartite: " << Algorithms::isBipartite(g) << endl; 
+
+    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2, 4}, B={1, 3}.");  
+
+}
+TEST_CASE("Testing the isbipartite4 function") {
+        vector<vector<int>> oddCycleGraph = {
+        {0, 1, 0},
+        {0, 0, 1},
+        {1, 0, 0}
+    };
+    g.loadGraph(oddCycleGraph);
+    g.printGraph();
+    cout << " " << Algorithms::isBipartite(g) << endl; 
+
+    CHECK(Algorithms::isBipartite(g) == "The graph is not bipartite.");  // Expect false because it's not bipartite
+
+}
+
+}
+
+
+
+
+TEST_SUITE("compressed graph tests") {
+
+TEST_CASE("Testing traversals on the compressed representation") {
+    vector<vector<int>> directedWeighted = {
+        {0, 4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, 2},
+        {1, 0, 0, 0}
+    };
+    vector<vector<int>> undirectedDisconnected = {
+        {0, 1, 0, 0},
+        {1, 0, 0, 0},
+        {0, 0, 0, 1},
+        {0, 0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(directedWeighted);
+    ariel::CompressedGraph compressed(g);
+    CHECK(Algorithms::isConnected(compressed) == true);
+    CHECK(Algorithms::shortestPath(compressed, 0, 3) == Algorithms::shortestPath(g, 0, 3));
+    CHECK(Algorithms::isBipartite(compressed) == Algorithms::isBipartite(g));
+
+    g.loadGraph(undirectedDisconnected);
+    compressed = ariel::CompressedGraph(g);
+    CHECK(Algorithms::isConnected(compressed) == false);
+    CHECK(Algorithms::shortestPath(compressed, 0, 3) == "-1");
+    CHECK(Algorithms::isBipartite(compressed) == "The graph is bipartite: A={0, 2}, B={1, 3}.");
+}
+
+}
+
+TEST_SUITE("typed result tests") {
+
+TEST_CASE("Testing the typed shortestPath") {
+    vector<vector<int>> directedWeighted = {
+        {0, 4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, 2},
+        {1, 0, 0, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(directedWeighted);
+
+    ariel::PathResult result;
+    Algorithms::shortestPath(g, 0, 3, result);
+    CHECK(result.status == ariel::PathStatus::Found);
+    CHECK(result.distance == 11);
+    CHECK(result.path == vector<int>({0, 1, 2, 3}));
+
+    Algorithms::shortestPath(g, 3, 3, result); // the same result object is reused
+    CHECK(result.status == ariel::PathStatus::Found);
+    CHECK(result.distance == 0);
+    CHECK(result.path == vector<int>({3}));
+
+    vector<vector<int>> negativeCycle = {
+        {0, 1, 0},
+        {0, 0, -3},
+        {0, 1, 0}
+    };
+    g.loadGraph(negativeCycle);
+    Algorithms::shortestPath(g, 0, 2, result);
+    CHECK(result.status == ariel::PathStatus::NegativeCycle);
+    CHECK(result.path.empty());
+    Algorithms::shortestPath(g, 2, 0, result);
+    CHECK(result.status == ariel::PathStatus::NegativeCycle); // the cycle 1->2->1 is reachable from 2
+}
+
+TEST_CASE("Testing the typed cycle and bipartition results") {
+    vector<vector<int>> tree = {
+        {0, 1, 0, 0, 0},
+        {1, 0, 1, 1, 0},
+        {0, 1, 0, 0, 0},
+        {0, 1, 0, 0, 1},
+        {0, 0, 0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(tree);
+    vector<int> colors;
+    CHECK(Algorithms::isBipartite(g, colors) == true);
+    CHECK(colors == vector<int>({0, 1, 0, 0, 1}));
+    vector<int> cycle;
+    CHECK(Algorithms::isContainsCycle(g, cycle) == false);
+    CHECK(Algorithms::negativeCycle(g, cycle) == false);
+
+    vector<vector<int>> directedWeightedNegative = {
+        {0, -4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, -2},
+        {-1, 0, 0, 0}
+    };
+    g.loadGraph(directedWeightedNegative);
+    CHECK(Algorithms::negativeCycle(g, cycle) == true);
+    CHECK(cycle == vector<int>({0, 1, 2, 3}));
+    CHECK(Algorithms::formatPath(cycle, true) == "0->1->2->3->0");
+    CHECK(Algorithms::formatPath(cycle) == "0->1->2->3");
+    CHECK(Algorithms::formatPath(vector<int>()) == "");
+}
+
+}
+
+TEST_SUITE("shortest path tree tests") {
+
+TEST_CASE("Testing shortestPathTree and pathTo") {
+    vector<vector<int>> undirectedWeighted = {
+        {0, 2, 0, 6},
+        {2, 0, 3, 0},
+        {0, 3, 0, 1},
+        {6, 0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(undirectedWeighted);
+
+    ariel::ShortestPathTree tree;
+    Algorithms::shortestPathTree(g, 0, tree);
+    CHECK(tree.negativeCycle == false);
+    CHECK(tree.distances == vector<long long>({0, 2, 5, 6}));
+
+    vector<int> path;
+    CHECK(Algorithms::pathTo(tree, 2, path) == true);
+    CHECK(path == vector<int>({0, 1, 2}));
+    CHECK(Algorithms::pathTo(tree, 0, path) == true);
+    CHECK(path == vector<int>({0}));
+    CHECK_THROWS_AS(Algorithms::pathTo(tree, 4, path), std::out_of_range);
+
+    vector<vector<int>> disconnected = {
+        {0, 1, 0},
+        {1, 0, 0},
+        {0, 0, 0}
+    };
+    g.loadGraph(disconnected);
+    Algorithms::shortestPathTree(g, 0, tree);
+    CHECK(Algorithms::pathTo(tree, 2, path) == false);
+    CHECK(path.empty());
+}
+
+TEST_CASE("Testing the shortest path tree cache") {
+    vector<vector<int>> directedWeighted = {
+        {0, 4, 0, 0},
+        {0, 0, 5, 0},
+        {0, 0, 0, 2},
+        {1, 0, 0, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(directedWeighted);
+
+    shared_ptr<const ariel::ShortestPathTree> first = Algorithms::cachedShortestPathTree(g, 0);
+    CHECK(Algorithms::cachedShortestPathTree(g, 0) == first); // served from the cache
+    CHECK(first->distances[3] == 11);
+
+    ariel::Graph copy = g;
+    CHECK(Algorithms::cachedShortestPathTree(copy, 0) == first); // identical contents share trees
+
+    g *= 2; // modification invalidates
+    shared_ptr<const ariel::ShortestPathTree> second = Algorithms::cachedShortestPathTree(g, 0);
+    CHECK(second != first);
+    CHECK(second->distances[3] == 22);
+    CHECK(first->distances[3] == 11); // earlier holders keep their tree
+
+    Algorithms::setShortestPathCacheCapacity(0);
+    CHECK(Algorithms::cachedShortestPathTree(g, 0) != second);
+    Algorithms::setShortestPathCacheCapacity(32);
+}
+
+}
+
+TEST_SUITE("all pairs tests") {
+
+TEST_CASE("Testing allPairsShortestPaths against single-source results") {
+    // 150 vertices spans three tiles; forward edges may be negative, backward ones are not
+    const int n = 150;
+    vector<vector<int>> weights(n, vector<int>(n, 0));
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            if (i == j || (i * 31 + j * 17) % 7 != 0) continue;
+            weights[i][j] = i < j ? (i * 13 + j * 5) % 19 - 6 : 3 + (i + j) % 10;
+            if (weights[i][j] == 0) weights[i][j] = 1;
+        }
+    }
+    // Keep backward edges heavy enough that every cycle stays non-negative
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < i; ++j) {
+            if (weights[i][j] != 0) weights[i][j] += 6 * n;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(weights);
+
+    ariel::AllPairsResult serial;
+    ariel::AllPairsResult parallel;
+    Algorithms::allPairsShortestPaths(g, serial, true, 1);
+    Algorithms::allPairsShortestPaths(g, parallel, true, 4);
+    CHECK(serial.negativeCycle == false);
+    CHECK(serial.distances == parallel.distances);
+
+    ariel::AllPairsResult johnson;
+    Algorithms::johnsonShortestPaths(g, johnson, 4);
+    CHECK(johnson.negativeCycle == false);
+    CHECK(johnson.distances == serial.distances);
+
+    ariel::ShortestPathTree tree;
+    vector<int> path;
+    for (int source = 0; source < n; source += 7) {
+        Algorithms::shortestPathTree(g, source, tree);
+        for (int target = 0; target < n; ++target) {
+            CHECK(serial.distance(source, target) == tree.distances[target]);
+            if (Algorithms::pathBetween(serial, source, target, path)) {
+                long long length = 0;
+                for (size_t k = 1; k < path.size(); ++k) {
+                    length += weights[path[k - 1]][path[k]];
+                }
+                CHECK(path.front() == source);
+                CHECK(path.back() == target);
+                CHECK(length == serial.distance(source, target));
+            }
+        }
+    }
+}
+
+TEST_CASE("Testing allPairsShortestPaths on small and cyclic graphs") {
+    vector<vector<int>> graph = {
+        {0, 4, 0, 0},
+        {0, 0, -2, 0},
+        {0, 0, 0, 3},
+        {0, 0, 0, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::AllPairsResult result;
+    Algorithms::allPairsShortestPaths(g, result);
+    CHECK(result.distance(0, 3) == 5);
+    CHECK(result.distance(3, 0) == LLONG_MAX);
+    vector<int> path;
+    CHECK(Algorithms::pathBetween(result, 3, 0, path) == false);
+    CHECK_THROWS_AS(Algorithms::pathBetween(result, 0, 3, path), std::invalid_argument);
+
+    graph[2][0] = -3; // 0->1->2->0 weighs -1
+    g.loadGraph(graph);
+    Algorithms::allPairsShortestPaths(g, result, true);
+    CHECK(result.negativeCycle == true);
+    CHECK(result.distances.empty());
+    CHECK(Algorithms::pathBetween(result, 0, 3, path) == false);
+    Algorithms::johnsonShortestPaths(g, result);
+    CHECK(result.negativeCycle == true);
+}
+
+TEST_CASE("Testing johnsonShortestPaths and potentials reuse") {
+    vector<vector<int>> graph = {
+        {0, 3, 8, 0, -4},
+        {0, 0, 0, 1, 7},
+        {0, 4, 0, 0, 0},
+        {2, 0, -5, 0, 0},
+        {0, 0, 0, 6, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::AllPairsResult result;
+    Algorithms::johnsonShortestPaths(g, result);
+    vector<long long> expected = {
+        0, 1, -3, 2, -4,
+        3, 0, -4, 1, -1,
+        7, 4, 0, 5, 3,
+        2, -1, -5, 0, -2,
+        8, 5, 1, 6, 0
+    };
+    CHECK(result.distances == expected);
+
+    // Single-source queries on the same graph reuse the potentials and run Dijkstra
+    for (int target = 0; target < 5; ++target) {
+        ariel::PathResult path;
+        Algorithms::shortestPath(g, 4, target, path);
+        CHECK(path.status == ariel::PathStatus::Found);
+        CHECK(path.distance == expected[4 * 5 + target]);
+    }
+    CHECK(Algorithms::shortestPath(g, 0, 2) == "0->4->3->2");
+}
+
+}
+
+TEST_SUITE("delta stepping tests") {
+
+TEST_CASE("Testing deltaSteppingTree against the sequential tree") {
+    // Sparse graph (CSR backend) and a dense one (matrix backend)
+    for (int density : {40, 2}) {
+        const int n = 300;
+        vector<vector<int>> weights(n, vector<int>(n, 0));
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (i != j && (i * 131 + j * 71) % density == 0) {
+                    weights[i][j] = 1 + (i * 17 + j * 29) % 50;
+                }
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(weights);
+
+        ariel::ShortestPathTree expected;
+        Algorithms::shortestPathTree(g, 5, expected);
+        for (unsigned threads : {1u, 4u}) {
+            for (long long delta : {0LL, 1LL, 7LL, 1000LL}) {
+                ariel::ShortestPathTree tree;
+                Algorithms::deltaSteppingTree(g, 5, tree, delta, threads);
+                CHECK(tree.distances == expected.distances);
+                for (int v = 0; v < n; ++v) {
+                    int parent = tree.parents[v];
+                    if (parent != -1) {
+                        CHECK(tree.distances[v] == tree.distances[parent] + weights[parent][v]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Testing deltaSteppingTree on unreachable and negative-weight graphs") {
+    vector<vector<int>> graph = {
+        {0, 2, 0, 0},
+        {0, 0, 3, 0},
+        {0, 0, 0, 0},
+        {0, 0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::ShortestPathTree tree;
+    Algorithms::deltaSteppingTree(g, 0, tree, 0, 3);
+    CHECK(tree.distances == vector<long long>({0, 2, 5, LLONG_MAX}));
+    vector<int> path;
+    CHECK(Algorithms::pathTo(tree, 2, path) == true);
+    CHECK(path == vector<int>({0, 1, 2}));
+
+    graph[3][1] = -1;
+    g.loadGraph(graph);
+    Algorithms::deltaSteppingTree(g, 3, tree);
+    CHECK(tree.distances == vector<long long>({LLONG_MAX, -1, 1, 0}));
+    CHECK_THROWS_AS(Algorithms::deltaSteppingTree(g, 4, tree), std::out_of_range);
+}
+
+}
+
+TEST_SUITE("point to point tests") {
+
+TEST_CASE("Testing bidirectional Dijkstra and A* on a grid") {
+    // 20x20 grid with weights 2..9; Manhattan distance times 2 is admissible
+    const int side = 20;
+    const int n = side * side;
+    vector<vector<int>> weights(n, vector<int>(n, 0));
+    for (int r = 0; r < side; ++r) {
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            if (c + 1 < side) weights[v][v + 1] = weights[v + 1][v] = 2 + (r * 7 + c * 3) % 8;
+            if (r + 1 < side) weights[v][v + side] = weights[v + side][v] = 2 + (r * 5 + c * 11) % 8;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(weights);
+
+    for (int start : {0, 57, 210, 399}) {
+        for (int end : {0, 19, 133, 380, 398}) {
+            ariel::PathResult expected;
+            ariel::PathResult bidirectional;
+            ariel::PathResult aStar;
+            Algorithms::shortestPath(g, start, end, expected);
+            Algorithms::bidirectionalShortestPath(g, start, end, bidirectional);
+            Algorithms::aStarShortestPath(g, start, end, [&](int v) {
+                return 2LL * (abs(v / side - end / side) + abs(v % side - end % side));
+            }, aStar);
+            CHECK(bidirectional.status == ariel::PathStatus::Found);
+            CHECK(aStar.status == ariel::PathStatus::Found);
+            CHECK(bidirectional.distance == expected.distance);
+            CHECK(aStar.distance == expected.distance);
+            for (const ariel::PathResult* result : {&bidirectional, &aStar}) {
+                long long length = 0;
+                for (size_t k = 1; k < result->path.size(); ++k) {
+                    length += weights[result->path[k - 1]][result->path[k]];
+                }
+                CHECK(result->path.front() == start);
+                CHECK(result->path.back() == end);
+                CHECK(length == expected.distance);
+            }
+        }
+    }
+
+    // Admissible but inconsistent estimate: vertices have to be expanded again
+    ariel::PathResult expected;
+    ariel::PathResult aStar;
+    Algorithms::shortestPath(g, 0, 399, expected);
+    Algorithms::aStarShortestPath(g, 0, 399, [&](int v) { return v % 3 == 0 ? 2LL * (38 - v / side - v % side) : 0LL; }, aStar);
+    CHECK(aStar.distance == expected.distance);
+}
+
+TEST_CASE("Testing point-to-point searches with negative weights and no path") {
+    vector<vector<int>> graph = {
+        {0, 3, 8, 0, -4},
+        {0, 0, 0, 1, 7},
+        {0, 4, 0, 0, 0},
+        {2, 0, -5, 0, 0},
+        {0, 0, 0, 6, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::PathResult result;
+    Algorithms::bidirectionalShortestPath(g, 0, 2, result);
+    CHECK(result.status == ariel::PathStatus::Found);
+    CHECK(result.distance == -3);
+    CHECK(result.path == vector<int>({0, 4, 3, 2}));
+    Algorithms::bidirectionalShortestPath(g, 1, 1, result);
+    CHECK(result.path == vector<int>({1}));
+    CHECK(result.distance == 0);
+    CHECK_THROWS_AS(Algorithms::aStarShortestPath(g, 0, 2, [](int) { return 0LL; }, result), std::invalid_argument);
+
+    vector<vector<int>> split = {
+        {0, 1, 0},
+        {1, 0, 0},
+        {0, 0, 0}
+    };
+    g.loadGraph(split);
+    Algorithms::bidirectionalShortestPath(g, 0, 2, result);
+    CHECK(result.status == ariel::PathStatus::NoPath);
+    Algorithms::aStarShortestPath(g, 2, 0, [](int) { return 0LL; }, result);
+    CHECK(result.status == ariel::PathStatus::NoPath);
+    CHECK(result.path.empty());
+}
+
+}
+
+TEST_SUITE("connectivity tests") {
+
+TEST_CASE("Testing strongly and weakly connected components") {
+    // {0,1,2} -> {3,4} -> {5}, and an isolated vertex 6
+    vector<vector<int>> graph = {
+        {0, 1, 0, 0, 0, 0, 0},
+        {0, 0, 1, 0, 0, 0, 0},
+        {1, 0, 0, 1, 0, 0, 0},
+        {0, 0, 0, 0, 1, 0, 0},
+        {0, 0, 0, 1, 0, 1, 0},
+        {0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(graph);
+
+    vector<int> components;
+    CHECK(Algorithms::stronglyConnectedComponents(g, components) == 4);
+    CHECK(components[0] == components[1]);
+    CHECK(components[1] == components[2]);
+    CHECK(components[3] == components[4]);
+    // Reverse topological order: sinks get smaller ids
+    CHECK(components[5] < components[3]);
+    CHECK(components[3] < components[0]);
+    CHECK(Algorithms::isStronglyConnected(g) == false);
+
+    CHECK(Algorithms::weaklyConnectedComponents(g, components) == 2);
+    CHECK(components == vector<int>({0, 0, 0, 0, 0, 0, 1}));
+    CHECK(Algorithms::isWeaklyConnected(g) == false);
+    CHECK(Algorithms::findRoot(g) == -1);
+    CHECK(Algorithms::isConnected(g) == false);
+
+    graph[5][6] = 1;
+    g.loadGraph(graph);
+    CHECK(Algorithms::isWeaklyConnected(g) == true);
+    CHECK(Algorithms::findRoot(g) == 0);
+    CHECK(Algorithms::isConnected(g) == true);
+
+    graph[6][0] = 1;
+    g.loadGraph(graph);
+    CHECK(Algorithms::isStronglyConnected(g) == true);
+}
+
+TEST_CASE("Testing breadthFirstSearch in both directions") {
+    // Low-diameter directed graph: the middle levels are large enough for bottom-up steps
+    for (int density : {5, 61}) {
+        const int n = 600;
+        vector<vector<int>> graph(n, vector<int>(n, 0));
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (i != j && (i * 53 + j * 19 + i * j) % density == 0) graph[i][j] = 1 + (i + j) % 3;
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(graph);
+
+        // Reference levels from a plain queue
+        vector<int> expected(n, -1);
+        vector<int> queue = {7};
+        expected[7] = 0;
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int u = queue[head];
+            for (int v = 0; v < n; ++v) {
+                if (graph[u][v] != 0 && expected[v] == -1) {
+                    expected[v] = expected[u] + 1;
+                    queue.push_back(v);
+                }
+            }
+        }
+
+        ariel::BfsTree tree;
+        Algorithms::breadthFirstSearch(g, 7, tree);
+        CHECK(tree.levels == expected);
+        for (int v = 0; v < n; ++v) {
+            if (v != 7 && tree.levels[v] != -1) {
+                CHECK(graph[tree.parents[v]][v] != 0);
+                CHECK(tree.levels[tree.parents[v]] == tree.levels[v] - 1);
+            }
+        }
+        ariel::CompressedGraph compressed(g);
+        Algorithms::breadthFirstSearch(compressed, 7, tree);
+        CHECK(tree.levels == expected);
+    }
+
+    vector<vector<int>> split = {
+        {0, 1, 0},
+        {0, 0, 0},
+        {0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(split);
+    ariel::BfsTree tree;
+    Algorithms::breadthFirstSearch(g, 0, tree);
+    CHECK(tree.levels == vector<int>({0, 1, -1}));
+    CHECK(tree.parents == vector<int>({-1, 0, -1}));
+    CHECK(Algorithms::findRoot(g) == -1);
+    CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2}, B={1}.");
+}
+
+TEST_CASE("Testing parallelConnectedComponents on every storage") {
+    // Sparse directed graph with many small components (CSR), then a dense one (matrix)
+    for (int density : {3, 97}) {
+        const int n = 400;
+        vector<vector<int>> graph(n, vector<int>(n, 0));
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (i != j && (i * 37 + j * 91) % density == 0 && (i % 50) < 45 && (j % 50) < 45 && i / 50 == j / 50) {
+                    graph[i][j] = 1; // edges stay inside blocks of 50, whose last 5 vertices are isolated
+                }
+            }
+        }
+        graph[10][120] = 2; // join blocks 0 and 2 in one direction only
+        ariel::Graph g;
+        g.loadGraph(graph);
+
+        vector<int> expected;
+        int expectedCount = Algorithms::weaklyConnectedComponents(g, expected);
+        ariel::CompressedGraph compressed(g);
+        for (unsigned threads : {1u, 4u}) {
+            vector<int> components;
+            vector<int> sizes;
+            CHECK(Algorithms::parallelConnectedComponents(g, components, sizes, threads) == expectedCount);
+            CHECK(components == expected);
+            int total = 0;
+            for (int size : sizes) total += size;
+            CHECK(total == n);
+            CHECK(sizes[components[10]] == count(expected.begin(), expected.end(), expected[10]));
+            CHECK(Algorithms::parallelConnectedComponents(compressed, components, sizes, threads) == expectedCount);
+            CHECK(components == expected);
+        }
+    }
+}
+
+TEST_CASE("Testing connectivity on long paths and single vertices") {
+    // A 2000-vertex path would overflow a recursive DFS on small stacks
+    const int n = 2000;
+    vector<vector<int>> path(n, vector<int>(n, 0));
+    for (int v = 0; v + 1 < n; ++v) {
+        path[v + 1][v] = 1;
+    }
+    ariel::Graph g;
+    g.loadGraph(path);
+    vector<int> components;
+    CHECK(Algorithms::stronglyConnectedComponents(g, components) == n);
+    CHECK(Algorithms::findRoot(g) == n - 1);
+    CHECK(Algorithms::isConnected(g) == true);
+    path[0][n - 1] = 1;
+    g.loadGraph(path);
+    CHECK(Algorithms::isStronglyConnected(g) == true);
+
+    vector<vector<int>> single = {{0}};
+    g.loadGraph(single);
+    CHECK(Algorithms::findRoot(g) == 0);
+    CHECK(Algorithms::isConnected(g) == false); // no outgoing edges
+    single[0][0] = 1;
+    g.loadGraph(single);
+    CHECK(Algorithms::isConnected(g) == true);
+}
+
+}
+
+TEST_SUITE("parallel bipartite tests") {
+
+TEST_CASE("Testing parallelBipartition on many components") {
+    // 60 disjoint even cycles of length 10 plus isolated vertices
+    const int n = 700;
+    vector<vector<int>> graph(n, vector<int>(n, 0));
+    for (int c = 0; c < 60; ++c) {
+        for (int k = 0; k < 10; ++k) {
+            int u = c * 10 + k;
+            int v = c * 10 + (k + 1) % 10;
+            graph[u][v] = graph[v][u] = 1;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+
+    vector<int> sequential;
+    CHECK(Algorithms::isBipartite(g, sequential) == true);
+    for (unsigned threads : {1u, 4u}) {
+        ariel::BipartiteResult result;
+        Algorithms::parallelBipartition(g, result, threads);
+        CHECK(result.bipartite == true);
+        CHECK(result.colors == sequential);
+        CHECK(result.oddCycle.empty());
+    }
+
+    // Closing one cycle with a chord of odd length makes it non-bipartite
+    graph[300][302] = graph[302][300] = 1;
+    g.loadGraph(graph);
+    ariel::BipartiteResult result;
+    Algorithms::parallelBipartition(g, result, 4);
+    CHECK(result.bipartite == false);
+    CHECK(result.conflictEdge.first != -1);
+    CHECK(result.oddCycle.size() % 2 == 1);
+    for (size_t k = 0; k < result.oddCycle.size(); ++k) {
+        int u = result.oddCycle[k];
+        int v = result.oddCycle[(k + 1) % result.oddCycle.size()];
+        CHECK(u / 10 == 30);
+        CHECK((graph[u][v] != 0 || graph[v][u] != 0));
+    }
+}
+
+TEST_CASE("Testing parallelBipartition ignores edge directions") {
+    // Directed triangle: an odd cycle once directions are ignored
+    vector<vector<int>> triangle = {
+        {0, 1, 0},
+        {0, 0, 1},
+        {1, 0, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(triangle);
+    ariel::BipartiteResult result;
+    Algorithms::parallelBipartition(g, result);
+    CHECK(result.bipartite == false);
+    CHECK(result.oddCycle.size() == 3);
+
+    // 2 -> 0 and 2 -> 1 only reach 0 and 1 through in-edges
+    vector<vector<int>> star = {
+        {0, 0, 0},
+        {0, 0, 0},
+        {1, 1, 0}
+    };
+    g.loadGraph(star);
+    Algorithms::parallelBipartition(g, result);
+    CHECK(result.bipartite == true);
+    CHECK(result.colors == vector<int>({0, 0, 1}));
+
+    vector<vector<int>> selfLoop = {
+        {0, 1},
+        {1, 5}
+    };
+    g.loadGraph(selfLoop);
+    Algorithms::parallelBipartition(g, result);
+    CHECK(result.bipartite == false);
+    CHECK(result.conflictEdge == std::make_pair(1, 1));
+    CHECK(result.oddCycle == vector<int>({1}));
+}
+
+}
+
+TEST_SUITE("DAG tests") {
+
+TEST_CASE("Testing topologicalOrder") {
+    // 5 -> 2 -> 3 -> 1, 5 -> 0, 4 -> 0, 4 -> 1
+    vector<vector<int>> graph(6, vector<int>(6, 0));
+    graph[5][2] = graph[5][0] = graph[4][0] = graph[4][1] = graph[2][3] = graph[3][1] = 1;
+    ariel::Graph g;
+    g.loadGraph(graph);
+    for (unsigned threads : {1u, 4u}) {
+        vector<int> order;
+        CHECK(Algorithms::topologicalOrder(g, order, threads) == true);
+        CHECK(order == vector<int>({4, 5, 0, 2, 3, 1}));
+    }
+    CHECK(Algorithms::isAcyclic(g) == true);
+
+    // Closing 1 -> 5 makes 5 -> 2 -> 3 -> 1 -> 5 a cycle; only 4 and 0 are in front of it
+    graph[1][5] = 1;
+    g.loadGraph(graph);
+    vector<int> order;
+    CHECK(Algorithms::topologicalOrder(g, order) == false);
+    CHECK(order == vector<int>({4}));
+    CHECK(Algorithms::isAcyclic(g) == false);
+
+    // Undirected edges are 2-cycles, so only isolated vertices are ordered; a graph
+    // without edges is trivially acyclic
+    vector<vector<int>> undirected = {
+        {0, 1, 0},
+        {1, 0, 0},
+        {0, 0, 0}
+    };
+    g.loadGraph(undirected);
+    CHECK(Algorithms::isAcyclic(g) == false);
+    CHECK(Algorithms::topologicalOrder(g, order) == false);
+    CHECK(order == vector<int>({2}));
+    g.loadGraph(vector<vector<int>>(3, vector<int>(3, 0)));
+    CHECK(Algorithms::topologicalOrder(g, order) == true);
+    CHECK(order == vector<int>({0, 1, 2}));
+}
+
+TEST_CASE("Testing dagPaths and shortestPath on a DAG with negative weights") {
+    // 0 -> 1 (5), 0 -> 2 (3), 1 -> 3 (6), 1 -> 2 (2), 2 -> 4 (4), 2 -> 5 (2), 2 -> 3 (7),
+    // 3 -> 4 (-1), 4 -> 5 (-2)
+    vector<vector<int>> graph(6, vector<int>(6, 0));
+    graph[0][1] = 5; graph[0][2] = 3; graph[1][3] = 6; graph[1][2] = 2; graph[2][4] = 4;
+    graph[2][5] = 2; graph[2][3] = 7; graph[3][4] = -1; graph[4][5] = -2;
+    ariel::Graph g;
+    g.loadGraph(graph);
+
+    ariel::DagPaths paths;
+    CHECK(Algorithms::dagPaths(g, 1, paths) == true);
+    CHECK(paths.source == 1);
+    CHECK(paths.shortest == vector<long long>({LLONG_MAX, 0, 2, 6, 5, 3}));
+    CHECK(paths.longest == vector<long long>({LLONG_MIN, 0, 2, 9, 8, 6}));
+    CHECK(paths.longestParents == vector<int>({-1, -1, 1, 2, 3, 4}));
+
+    // shortestPath takes the DAG pass and agrees with the negative-weight searches
+    CHECK(Algorithms::shortestPath(g, 0, 5) == "0->2->5");
+    CHECK(Algorithms::shortestPath(g, 1, 5) == "1->3->4->5");
+    CHECK(Algorithms::shortestPath(g, 3, 5) == "3->4->5");
+    CHECK(Algorithms::shortestPath(g, 5, 0) == "-1");
+    ariel::ShortestPathTree tree;
+    Algorithms::shortestPathTree(g, 0, tree);
+    CHECK(tree.negativeCycle == false);
+    CHECK(tree.distances == vector<long long>({0, 5, 3, 10, 7, 5}));
+
+    // Once the graph has a cycle, dagPaths refuses it and shortestPath falls back
+    graph[5][0] = 1;
+    g.loadGraph(graph);
+    CHECK(Algorithms::dagPaths(g, 0, paths) == false);
+    CHECK(Algorithms::shortestPath(g, 3, 0) == "3->4->5->0");
+}
+
+}
+
+TEST_SUITE("spanning tree tests") {
+
+TEST_CASE("Testing Prim and Boruvka on a small graph") {
+    //    0 --4-- 1
+    //    |     / |      3 --(-2)-- 5   (second component)
+    //    1   2   6
+    //    |  /    |
+    //    2 --8-- 4
+    vector<vector<int>> graph(6, vector<int>(6, 0));
+    auto edge = [&](int u, int v, int w) { graph[u][v] = graph[v][u] = w; };
+    edge(0, 1, 4); edge(0, 2, 1); edge(1, 2, 2); edge(1, 4, 6); edge(2, 4, 8); edge(3, 5, -2);
+    ariel::Graph g;
+    g.loadGraph(graph);
+
+    ariel::SpanningForest prim;
+    Algorithms::primSpanningForest(g, prim);
+    CHECK(prim.trees == 2);
+    CHECK(prim.totalWeight == 7);
+    REQUIRE(prim.edges.size() == 4);
+    CHECK((prim.edges[0].from == 0 && prim.edges[0].to == 2 && prim.edges[0].weight == 1));
+    CHECK((prim.edges[1].from == 1 && prim.edges[1].to == 2 && prim.edges[1].weight == 2));
+    CHECK((prim.edges[2].from == 1 && prim.edges[2].to == 4 && prim.edges[2].weight == 6));
+    CHECK((prim.edges[3].from == 3 && prim.edges[3].to == 5 && prim.edges[3].weight == -2));
+
+    for (unsigned threads : {1u, 4u}) {
+        ariel::SpanningForest boruvka;
+        Algorithms::boruvkaSpanningForest(g, boruvka, threads);
+        CHECK(boruvka.trees == 2);
+        CHECK(boruvka.totalWeight == 7);
+        REQUIRE(boruvka.edges.size() == prim.edges.size());
+        for (size_t i = 0; i < prim.edges.size(); ++i) {
+            CHECK(boruvka.edges[i].from == prim.edges[i].from);
+            CHECK(boruvka.edges[i].to == prim.edges[i].to);
+        }
+    }
+
+    ariel::SpanningForest forest;
+    Algorithms::minimumSpanningForest(g, forest);
+    CHECK(forest.totalWeight == 7);
+
+    // Directed graphs have no spanning tree in this sense
+    graph[0][1] = 0;
+    g.loadGraph(graph);
+    CHECK_THROWS_AS(Algorithms::primSpanningForest(g, forest), std::invalid_argument);
+    CHECK_THROWS_AS(Algorithms::boruvkaSpanningForest(g, forest), std::invalid_argument);
+}
+
+TEST_CASE("Testing Prim and Boruvka agree on larger forests") {
+    // Blocks of 60 vertices with many tied weights; the last vertex of each block is isolated
+    for (int density : {4, 1}) {
+        const int n = 300;
+        vector<vector<int>> graph(n, vector<int>(n, 0));
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                if (i / 60 == j / 60 && i % 60 != 59 && j % 60 != 59 && (i * 31 + j * 17) % density == 0) {
+                    graph[i][j] = graph[j][i] = (i * j) % 7 - 3 == 0 ? 5 : (i * j) % 7 - 3;
+                }
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(graph);
+        vector<int> components;
+        int expectedTrees = Algorithms::weaklyConnectedComponents(g, components);
+
+        ariel::SpanningForest prim;
+        Algorithms::primSpanningForest(g, prim);
+        CHECK(prim.trees == expectedTrees);
+        CHECK(prim.edges.size() == static_cast<size_t>(n - expectedTrees));
+        for (unsigned threads : {1u, 3u, 8u}) {
+            ariel::SpanningForest boruvka;
+            Algorithms::boruvkaSpanningForest(g, boruvka, threads);
+            CHECK(boruvka.trees == expectedTrees);
+            CHECK(boruvka.totalWeight == prim.totalWeight);
+            // The chosen edges really form a forest spanning each component
+            vector<vector<int>> tree(n, vector<int>(n, 0));
+            for (const ariel::SpanningEdge &e : boruvka.edges) {
+                CHECK(graph[e.from][e.to] == e.weight);
+                tree[e.from][e.to] = tree[e.to][e.from] = 1;
+            }
+            ariel::Graph t;
+            t.loadGraph(tree);
+            vector<int> treeComponents;
+            CHECK(Algorithms::weaklyConnectedComponents(t, treeComponents) == expectedTrees);
+            CHECK(treeComponents == components);
+        }
+    }
+}
+
+}
+
+TEST_SUITE("maximum flow tests") {
+
+// Checks capacities, conservation and that the cut's capacity equals the flow value
+static void checkFlow(const vector<vector<int>> &capacity, int source, int sink, const ariel::FlowResult &result) {
+    int n = capacity.size();
+    REQUIRE(result.numVertices == n);
+    REQUIRE(result.sourceSide[source] == true);
+    REQUIRE(result.sourceSide[sink] == false);
+    long long cut = 0;
+    for (int u = 0; u < n; ++u) {
+        long long balance = 0;
+        for (int v = 0; v < n; ++v) {
+            CHECK(result.flow(u, v) >= 0);
+            CHECK(result.flow(u, v) <= (u == v ? 0 : capacity[u][v]));
+            balance += result.flow(v, u) - result.flow(u, v);
+            if (result.sourceSide[u] && !result.sourceSide[v]) {
+                cut += capacity[u][v];
+                CHECK(result.flow(u, v) == capacity[u][v]);
+            }
+        }
+        if (u == source) {
+            CHECK(balance == -result.value);
+        } else if (u == sink) {
+            CHECK(balance == result.value);
+        } else {
+            CHECK(balance == 0);
+        }
+    }
+    CHECK(cut == result.value);
+}
+
+TEST_CASE("Testing maximumFlow on a small network") {
+    // The classic six-vertex network with maximum flow 23
+    vector<vector<int>> capacity = {
+        {0, 16, 13, 0, 0, 0},
+        {0, 0, 10, 12, 0, 0},
+        {0, 4, 0, 0, 14, 0},
+        {0, 0, 9, 0, 0, 20},
+        {0, 0, 0, 7, 0, 4},
+        {0, 0, 0, 0, 0, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(capacity);
+    ariel::FlowResult result;
+    Algorithms::maximumFlow(g, 0, 5, result);
+    CHECK(result.value == 23);
+    checkFlow(capacity, 0, 5, result);
+    CHECK(result.sourceSide == vector<bool>({true, true, true, false, true, false}));
+
+    // Nothing flows backwards from the sink
+    Algorithms::maximumFlow(g, 5, 0, result);
+    CHECK(result.value == 0);
+    CHECK(result.sourceSide == vector<bool>({false, true, true, true, true, true}));
+
+    CHECK_THROWS_AS(Algorithms::maximumFlow(g, 0, 0, result), std::invalid_argument);
+    CHECK_THROWS_AS(Algorithms::maximumFlow(g, 0, 6, result), std::out_of_range);
+    capacity[1][2] = -1;
+    g.loadGraph(capacity);
+    CHECK_THROWS_AS(Algorithms::maximumFlow(g, 0, 5, result), std::invalid_argument);
+}
+
+TEST_CASE("Testing maximumFlow on larger networks") {
+    // Undirected layers, dead ends that trap excess, and a dense directed graph
+    for (int variant = 0; variant < 3; ++variant) {
+        const int n = 120;
+        vector<vector<int>> capacity(n, vector<int>(n, 0));
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < n; ++j) {
+                if (i == j) continue;
+                int c = (i * 53 + j * 29 + variant * 7) % 23;
+                if (variant == 0 && i < j && (i / 10 + 1 == j / 10) && c < 12) capacity[i][j] = capacity[j][i] = c + 1;
+                if (variant == 1 && i < j && c < 4) capacity[i][j] = c + 1 + (j % 10 == 9 ? 50 : 0);
+                if (variant == 2 && c < 15) capacity[i][j] = c + 1;
+            }
+        }
+        ariel::Graph g;
+        g.loadGraph(capacity);
+        ariel::FlowResult result;
+        Algorithms::maximumFlow(g, 0, n - 1, result);
+        CHECK(result.value > 0);
+        checkFlow(capacity, 0, n - 1, result);
+    }
+}
+
+}
+
+TEST_SUITE("dynamic connectivity tests") {
+
+TEST_CASE("Testing DynamicConnectivity under insertions and deletions") {
+    ariel::Graph g;
+    g.loadGraph(vector<vector<int>>(6, vector<int>(6, 0)));
+    ariel::DynamicConnectivity dynamic(g);
+    CHECK(dynamic.getNumComponents() == 6);
+    CHECK(dynamic.isConnected() == false);
+
+    // Path 0 - 1 - 2 and a directed arc 4 -> 3
+    dynamic.addEdge(0, 1);
+    dynamic.addEdge(1, 0);
+    dynamic.addEdge(1, 2, 7);
+    dynamic.addEdge(4, 3);
+    CHECK(g.getAdjacencyMatrix()[1][2] == 7);
+    CHECK(dynamic.connected(0, 2) == true);
+    CHECK(dynamic.connected(3, 4) == true);
+    CHECK(dynamic.connected(2, 3) == false);
+    CHECK(dynamic.getNumComponents() == 3);
+    CHECK(dynamic.componentOf(4) == 3);
+
+    // Closing the cycle 0 - 1 - 2 - 0, then removing one of its edges keeps it connected
+    dynamic.addEdge(2, 0);
+    CHECK(dynamic.removeEdge(0, 1) == true);
+    CHECK(dynamic.connected(0, 1) == true); // 1 -> 0 is still there
+    CHECK(dynamic.removeEdge(1, 0) == true);
+    CHECK(dynamic.connected(0, 1) == true); // through 2
+    CHECK(dynamic.removeEdge(1, 2) == true);
+    CHECK(dynamic.connected(0, 1) == false);
+    CHECK(dynamic.connected(0, 2) == true);
+    CHECK(dynamic.removeEdge(1, 2) == false);
+    CHECK(dynamic.getNumComponents() == 4);
+
+    // Edits made on the graph itself are picked up
+    g.addEdge(5, 1);
+    CHECK(dynamic.connected(1, 5) == true);
+    dynamic.addEdge(2, 3);
+    dynamic.addEdge(1, 4);
+    CHECK(dynamic.isConnected() == true);
+    CHECK(dynamic.componentOf(5) == 0);
+
+    CHECK_THROWS_AS(dynamic.connected(0, 6), std::out_of_range);
+    CHECK_THROWS_AS(dynamic.addEdge(0, 6), std::out_of_range);
+}
+
+TEST_CASE("Testing DynamicConnectivity against a full recount") {
+    const int n = 40;
+    ariel::Graph g;
+    g.loadGraph(vector<vector<int>>(n, vector<int>(n, 0)));
+    ariel::DynamicConnectivity dynamic(g);
+    unsigned state = 7;
+    for (int step = 0; step < 2000; ++step) {
+        state = state * 1103515245 + 12345;
+        int u = (state >> 8) % n;
+        int v = (state >> 16) % n;
+        if ((state >> 28) % 3 == 0) {
+            dynamic.addEdge(u, v);
+        } else {
+            dynamic.removeEdge(u, v);
+        }
+        if (step % 10 == 0) {
+            vector<int> components;
+            CHECK(dynamic.getNumComponents() == Algorithms::weaklyConnectedComponents(g, components));
+            CHECK(dynamic.connected(u, v) == (components[u] == components[v]));
+        }
+    }
+}
+
+}
+
+TEST_SUITE("dynamic shortest path tests") {
+
+TEST_CASE("Testing DynamicShortestPaths repairs") {
+    // 0 -> 1 -> 2 -> 3 with a detour 0 -> 4 -> 3
+    vector<vector<int>> graph(5, vector<int>(5, 0));
+    graph[0][1] = 1; graph[1][2] = 1; graph[2][3] = 1; graph[0][4] = 2; graph[4][3] = 2;
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::DynamicShortestPaths dynamic(g);
+    dynamic.addSource(0);
+    CHECK(dynamic.tree(0).distances == vector<long long>({0, 1, 2, 3, 2}));
+
+    // A dearer tree edge moves 3 onto the detour
+    dynamic.setWeight(1, 2, 5);
+    CHECK(g.getAdjacencyMatrix()[1][2] == 5);
+    CHECK(dynamic.tree(0).distances == vector<long long>({0, 1, 6, 4, 2}));
+    CHECK(dynamic.tree(0).parents == vector<int>({-1, 0, 1, 4, 0}));
+
+    // Removing the detour's first edge cuts 4 off
+    CHECK(dynamic.removeEdge(0, 4) == true);
+    CHECK(dynamic.distance(0, 4) == LLONG_MAX);
+    CHECK(dynamic.distance(0, 3) == 7);
+    CHECK(dynamic.removeEdge(0, 4) == false);
+
+    // A new shortcut improves everything behind it
+    dynamic.addEdge(0, 2, 1);
+    CHECK(dynamic.tree(0).distances == vector<long long>({0, 1, 1, 2, LLONG_MAX}));
+    vector<int> path;
+    CHECK(Algorithms::pathTo(dynamic.tree(0), 3, path) == true);
+    CHECK(path == vector<int>({0, 2, 3}));
+
+    // Negative weights fall back to recomputing
+    dynamic.addSource(1);
+    dynamic.addEdge(1, 0, -1);
+    CHECK(dynamic.distance(1, 3) == 1); // 1 -> 0 -> 2 -> 3
+    dynamic.setWeight(1, 0, 0);
+    CHECK(dynamic.distance(1, 0) == LLONG_MAX);
+
+    dynamic.removeSource(1);
+    CHECK_THROWS_AS(dynamic.tree(1), std::invalid_argument);
+    CHECK_THROWS_AS(dynamic.addSource(5), std::out_of_range);
+    CHECK_THROWS_AS(dynamic.setWeight(0, 5, 1), std::out_of_range);
+}
+
+TEST_CASE("Testing DynamicShortestPaths against recomputation") {
+    const int n = 30;
+    vector<vector<int>> graph(n, vector<int>(n, 0));
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            if (i != j && (i * 7 + j * 13) % 5 == 0) graph[i][j] = 1 + (i + j) % 9;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::DynamicShortestPaths dynamic(g);
+    for (int source : {0, 7, 19}) dynamic.addSource(source);
+
+    unsigned state = 11;
+    for (int step = 0; step < 600; ++step) {
+        state = state * 1103515245 + 12345;
+        int u = (state >> 8) % n;
+        int v = (state >> 16) % n;
+        int weight = (state >> 24) % 4 == 0 ? 0 : 1 + (state >> 26) % 12;
+        dynamic.setWeight(u, v, weight);
+        if (step == 300) {
+            g.addEdge(3, 4, 2); // made behind the tracker's back
+        }
+        for (int source : {0, 7, 19}) {
+            ariel::ShortestPathTree expected;
+            Algorithms::shortestPathTree(g, source, expected);
+            const ariel::ShortestPathTree &repaired = dynamic.tree(source);
+            CHECK(repaired.distances == expected.distances);
+            for (int w = 0; w < n; ++w) {
+                int p = repaired.parents[w];
+                if (p != -1) CHECK(repaired.distances[p] + g.getAdjacencyMatrix()[p][w] == repaired.distances[w]);
+            }
+        }
+    }
+}
+
+}
+
+TEST_SUITE("property cache tests") {
+
+TEST_CASE("Testing memoized properties follow graph changes") {
+    vector<vector<int>> graph = {
+        {0, 1, 0, 0},
+        {1, 0, 1, 0},
+        {0, 1, 0, 1},
+        {0, 0, 1, 0}
+    };
+    ariel::Graph g;
+    g.loadGraph(graph);
+    for (int round = 0; round < 3; ++round) {
+        CHECK(Algorithms::isConnected(g) == true);
+        CHECK(Algorithms::isBipartite(g) == "The graph is bipartite: A={0, 2}, B={1, 3}.");
+        CHECK(Algorithms::isContainsCycle(g) == "0");
+        CHECK(Algorithms::negativeCycle(g) == "0");
+    }
+
+    // Every edit gives a new version, so nothing stale is returned
+    g.addEdge(0, 2);
+    g.addEdge(2, 0);
+    CHECK(Algorithms::isBipartite(g) == "The graph is not bipartite.");
+    CHECK(Algorithms::isContainsCycle(g) == "0->1->2->0");
+    g.removeEdge(2, 3);
+    g.removeEdge(3, 2);
+    CHECK(Algorithms::isConnected(g) == false);
+    g.addEdge(3, 0, -5);
+    g.addEdge(0, 3, 1);
+    vector<int> cycle;
+    CHECK(Algorithms::negativeCycle(g, cycle) == true);
+    CHECK(cycle == vector<int>({0, 3}));
+    CHECK(Algorithms::negativeCycle(g, cycle) == true);
+    CHECK(cycle == vector<int>({0, 3}));
+    CHECK(Algorithms::negativeCycle(g) == "0->3->0"); // text stored with the typed answer
+
+    // Copies share the version and the answers; a disabled cache still answers
+    ariel::Graph copy = g;
+    CHECK(Algorithms::isConnected(copy) == true);
+    Algorithms::setPropertyCacheBudget(0);
+    CHECK(Algorithms::isConnected(g) == true);
+    CHECK(Algorithms::isContainsCycle(g, cycle) == true);
+    Algorithms::setPropertyCacheBudget(4 << 20);
+}
+
+TEST_CASE("Testing memoized properties from concurrent readers") {
+    const int n = 200;
+    vector<vector<int>> graph(n, vector<int>(n, 0));
+    for (int i = 0; i + 1 < n; ++i) graph[i][i + 1] = graph[i + 1][i] = 1;
+    ariel::Graph g;
+    g.loadGraph(graph);
+    vector<int> expected;
+    CHECK(Algorithms::isBipartite(g, expected) == true);
+
+    vector<int> failures(8, 0);
+    vector<std::thread> readers;
+    for (int t = 0; t < 8; ++t) {
+        readers.emplace_back([&, t]() {
+            for (int i = 0; i < 200; ++i) {
+                vector<int> colors;
+                vector<int> cycle;
+                if (!Algorithms::isConnected(g) || !Algorithms::isBipartite(g, colors) || colors != expected ||
+                    Algorithms::isContainsCycle(g, cycle)) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (std::thread &reader : readers) reader.join();
+    CHECK(failures == vector<int>(8, 0));
+}
+
+}
+
+TEST_SUITE("reachability tests") {
+
+TEST_CASE("Testing TransitiveClosure and GrailIndex on a small graph") {
+    // Cycle 0 -> 1 -> 2 -> 0 feeding 3 -> 4, with 5 only reaching 4
+    vector<vector<int>> graph(6, vector<int>(6, 0));
+    graph[0][1] = graph[1][2] = graph[2][0] = 1;
+    graph[2][3] = graph[3][4] = graph[5][4] = 1;
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::TransitiveClosure closure(g);
+    ariel::GrailIndex grail(g, 2);
+    CHECK(closure.getNumComponents() == 4);
+    CHECK(grail.getNumComponents() == 4);
+    for (int u = 0; u < 6; ++u) {
+        for (int v = 0; v < 6; ++v) {
+            bool expected = u == v || (u < 3 && v < 5) || (u == 3 && v == 4) || (u == 5 && v == 4);
+            CHECK(closure.reaches(u, v) == expected);
+            CHECK(grail.reaches(u, v) == expected);
+        }
+    }
+    CHECK_THROWS_AS(closure.reaches(0, 6), std::out_of_range);
+    CHECK_THROWS_AS(grail.reaches(-1, 0), std::out_of_range);
+    CHECK_THROWS_AS(ariel::GrailIndex(g, 0), std::invalid_argument);
+}
+
+TEST_CASE("Testing reachability indexes against breadth-first search") {
+    // Sparse random-looking digraph with a few cycles, and enough components for
+    // several words per row
+    const int n = 300;
+    vector<vector<int>> graph(n, vector<int>(n, 0));
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            int h = (i * 131 + j * 71) % 997;
+            if (i != j && ((j > i && h < 14) || (j < i && h < 2))) graph[i][j] = 1;
+        }
+    }
+    ariel::Graph g;
+    g.loadGraph(graph);
+    ariel::TransitiveClosure parallel(g, 4);
+    ariel::TransitiveClosure sequential(g, 1);
+    ariel::GrailIndex grail(g);
+    for (int u = 0; u < n; ++u) {
+        ariel::BfsTree tree;
+        Algorithms::breadthFirstSearch(g, u, tree);
+        for (int v = 0; v < n; ++v) {
+            bool expected = tree.levels[v] != -1;
+            CHECK(parallel.reaches(u, v) == expected);
+            CHECK(sequential.reaches(u, v) == expected);
+            CHECK(grail.reaches(u, v) == expected);
+        }
+    }
+}
+
+}